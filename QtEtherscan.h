@@ -26,3 +26,7 @@
  *  @brief This file needs to be included in your project to use QtEtherscan lib */
 
 #include "./src/qethsc_api.h"
+#include "./src/qethsc_blockfollower.h"
+#include "./src/qethsc_blockrangefetcher.h"
+#include "./src/qethsc_blockreceiptsfetcher.h"
+#include "./src/qethsc_coroutines.h"
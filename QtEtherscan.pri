@@ -4,11 +4,25 @@ DEFINES     += QTES_VERSION='\\"0.0.4\\"'
 
 QT          += core network
 
+# src/qethsc_coroutines.h additionally requires CONFIG += c++20 in the project including it
 CONFIG      += c++17
 
 SOURCES += \
     $$PWD/src/qethsc_api.cpp \
+    $$PWD/src/qethsc_blockfollower.cpp \
+    $$PWD/src/qethsc_blockrangefetcher.cpp \
+    $$PWD/src/qethsc_blockreceiptsfetcher.cpp \
+    $$PWD/src/qethsc_cancellationtoken.cpp \
+    $$PWD/src/qethsc_jsonrpc.cpp \
+    $$PWD/src/qethsc_latencytracker.cpp \
     $$PWD/src/qethsc_networking.cpp \
+    $$PWD/src/qethsc_paralleldecoding.cpp \
+    $$PWD/src/qethsc_pendingrequest.cpp \
+    $$PWD/src/qethsc_querytemplate.cpp \
+    $$PWD/src/qethsc_requestscheduler.cpp \
+    $$PWD/src/qethsc_requestscope.cpp \
+    $$PWD/src/qethsc_responsecache.cpp \
+    $$PWD/src/qethsc_subscription.cpp \
     $$PWD/src/types/proxy/eth_block.cpp \
     $$PWD/src/types/proxy/eth_log.cpp \
     $$PWD/src/types/proxy/eth_response.cpp \
@@ -18,6 +32,8 @@ SOURCES += \
     $$PWD/src/types/qethsc_beaconchainwithdrawal.cpp \
     $$PWD/src/types/qethsc_block.cpp \
     $$PWD/src/types/qethsc_blockandunclerewards.cpp \
+    $$PWD/src/types/qethsc_columnarlists.cpp \
+    $$PWD/src/types/qethsc_columns.cpp \
     $$PWD/src/types/qethsc_contractcreator.cpp \
     $$PWD/src/types/qethsc_contractexecutionstatus.cpp \
     $$PWD/src/types/qethsc_contractsourcecode.cpp \
@@ -49,10 +65,13 @@ SOURCES += \
     $$PWD/src/types/qethsc_etherhistoricalprice.cpp \
     $$PWD/src/types/qethsc_etherprice.cpp \
     $$PWD/src/types/qethsc_eventlogs.cpp \
+    $$PWD/src/types/qethsc_flatjson.cpp \
     $$PWD/src/types/qethsc_gasoracle.cpp \
     $$PWD/src/types/qethsc_internaltransaction.cpp \
     $$PWD/src/types/qethsc_nodescount.cpp \
     $$PWD/src/types/qethsc_nodessize.cpp \
+    $$PWD/src/types/qethsc_recordfilter.cpp \
+    $$PWD/src/types/qethsc_stringpool.cpp \
     $$PWD/src/types/qethsc_tokeninfo.cpp \
     $$PWD/src/types/qethsc_transaction.cpp \
     $$PWD/src/types/qethsc_uncle.cpp
@@ -60,9 +79,28 @@ SOURCES += \
 HEADERS += \
     $$PWD/QtEtherscan.h \
     $$PWD/src/qethsc_api.h \
+    $$PWD/src/qethsc_blockfollower.h \
+    $$PWD/src/qethsc_blockrangefetcher.h \
+    $$PWD/src/qethsc_blockreceiptsfetcher.h \
+    $$PWD/src/qethsc_cachepolicy.h \
+    $$PWD/src/qethsc_cancellationtoken.h \
+    $$PWD/src/qethsc_coroutines.h \
+    $$PWD/src/qethsc_endpoints.h \
+    $$PWD/src/qethsc_hedgingpolicy.h \
+    $$PWD/src/qethsc_jsonrpc.h \
+    $$PWD/src/qethsc_latencytracker.h \
     $$PWD/src/qethsc_networking.h \
+    $$PWD/src/qethsc_paralleldecoding.h \
+    $$PWD/src/qethsc_pendingrequest.h \
+    $$PWD/src/qethsc_querytemplate.h \
+    $$PWD/src/qethsc_requestcontext.h \
+    $$PWD/src/qethsc_requestscheduler.h \
+    $$PWD/src/qethsc_requestscope.h \
+    $$PWD/src/qethsc_responsecache.h \
+    $$PWD/src/qethsc_subscription.h \
     $$PWD/src/types/proxy/eth_block.h \
     $$PWD/src/types/proxy/eth_blocknumber.h \
+    $$PWD/src/types/proxy/eth_blockreceipts.h \
     $$PWD/src/types/proxy/eth_gasprice.h \
     $$PWD/src/types/proxy/eth_helper.h \
     $$PWD/src/types/proxy/eth_log.h \
@@ -75,6 +113,8 @@ HEADERS += \
     $$PWD/src/types/qethsc_beaconchainwithdrawal.h \
     $$PWD/src/types/qethsc_block.h \
     $$PWD/src/types/qethsc_blockandunclerewards.h \
+    $$PWD/src/types/qethsc_columnarlists.h \
+    $$PWD/src/types/qethsc_columns.h \
     $$PWD/src/types/qethsc_constants.h \
     $$PWD/src/types/qethsc_contractcreator.h \
     $$PWD/src/types/qethsc_contractexecutionstatus.h \
@@ -108,11 +148,14 @@ HEADERS += \
     $$PWD/src/types/qethsc_etherhistoricalprice.h \
     $$PWD/src/types/qethsc_etherprice.h \
     $$PWD/src/types/qethsc_eventlogs.h \
+    $$PWD/src/types/qethsc_flatjson.h \
     $$PWD/src/types/qethsc_gasoracle.h \
     $$PWD/src/types/qethsc_internaltransaction.h \
     $$PWD/src/types/qethsc_jsonobjectslist.h \
     $$PWD/src/types/qethsc_nodescount.h \
     $$PWD/src/types/qethsc_nodessize.h \
+    $$PWD/src/types/qethsc_recordfilter.h \
+    $$PWD/src/types/qethsc_stringpool.h \
     $$PWD/src/types/qethsc_tokeninfo.h \
     $$PWD/src/types/qethsc_transaction.h \
     $$PWD/src/types/qethsc_uncle.h
@@ -73,6 +73,18 @@ int main(int argc, char *argv[])
 
     QThread::currentThread()->sleep(5);
 
+    // Per-call deadline. Requests made within the scope will be aborted after 100 ms and reported as TimeoutError
+    {
+        QtEtherscan::RequestScope scope(&etherscan,100);
+        QtEtherscan::Proxy::BlockNumberResponse head = etherscan.eth_blockNumber();
+        if (etherscan.errorCode() == QtEtherscan::API::TimeoutError)
+            qDebug() << "Etherscan was not fast enough this time...";
+        else
+            qDebug() << head;
+    }
+
+    QThread::currentThread()->sleep(5);
+
     // If calling QtEtherscan::API::call method with wrong parameters - QtEtherscan::API::errorCode will still return
     // some reasonable error code
     QJsonObject result = etherscan.call({
@@ -25,7 +25,18 @@
 #include "./qethsc_api.h"
 
 #include <QUrlQuery>
+#include <QJsonArray>
 #include <QJsonDocument>
+#include <QEventLoop>
+#include <QPointer>
+#include <QTimer>
+
+#include <chrono>
+#include <memory>
+
+#include "./qethsc_jsonrpc.h"
+#include "./qethsc_pendingrequest.h"
+#include "./qethsc_paralleldecoding.h"
 
 namespace QtEtherscan {
 
@@ -37,41 +48,70 @@ namespace QtEtherscan {
  */
 
 API::API(QObject *parent)
-    : QObject{parent},m_errorCode{NoError}
+    : QObject{parent},m_multichainApi{false},m_cachePolicy{CachePolicy::endpointDefaults()},m_jsonRpcBatchSize{100},m_requestStatus{Networking::RequestFinished},m_fromEtherscan{true},m_errorCode{NoError}
 {
     setEtheriumNetwork(Mainnet);
 }
 
 API::API(const QString& apiKey,QObject* parent)
     : QObject{parent},
-      m_apiKey{apiKey},m_errorCode{NoError}
+      m_apiKey{apiKey},m_multichainApi{false},m_cachePolicy{CachePolicy::endpointDefaults()},m_jsonRpcBatchSize{100},m_requestStatus{Networking::RequestFinished},m_fromEtherscan{true},m_errorCode{NoError}
 {
     setEtheriumNetwork(Mainnet);
 }
 
 void API::setEtheriumNetwork(Network etheriumNetwork)
 {
-    switch (etheriumNetwork) {
+    m_activeEtheriumNetwork = etheriumNetwork;
+
+    // Multichain API has single URL for all networks, network is selected by chainid parameter
+    m_net.setApiHost(m_multichainApi ? QLatin1String("https://api.etherscan.io/v2/api") : networkUrl(etheriumNetwork));
+}
+
+void API::setMultichainApi(bool enabled)
+{
+    m_multichainApi = enabled;
+    setEtheriumNetwork(m_activeEtheriumNetwork);
+}
+
+QString API::networkUrl(Network network)
+{
+    switch (network) {
     case Mainnet:
-        m_net.setApiHost(QLatin1String("https://api.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api.etherscan.io/api");
     case Goerli:
-        m_net.setApiHost(QLatin1String("https://api-goerli.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api-goerli.etherscan.io/api");
     case Kovan:
-        m_net.setApiHost(QLatin1String("https://api-kovan.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api-kovan.etherscan.io/api");
     case RInkeby:
-        m_net.setApiHost(QLatin1String("https://api-rinkeby.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api-rinkeby.etherscan.io/api");
     case Ropsten:
-        m_net.setApiHost(QLatin1String("https://api-ropsten.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api-ropsten.etherscan.io/api");
     case Sepolia:
-        m_net.setApiHost(QLatin1String("https://api-sepolia.etherscan.io/api"));
-        return;
+        return QLatin1String("https://api-sepolia.etherscan.io/api");
     }
     Q_ASSERT(false);
+    return QString();
+}
+
+qint64 API::chainId(Network network)
+{
+    switch (network) {
+    case Mainnet:
+        return 1;
+    case Goerli:
+        return 5;
+    case Kovan:
+        return 42;
+    case RInkeby:
+        return 4;
+    case Ropsten:
+        return 3;
+    case Sepolia:
+        return 11155111;
+    }
+    Q_ASSERT(false);
+    return 0;
 }
 
 QJsonObject API::call(const QUrlQuery& query)
@@ -79,7 +119,7 @@ QJsonObject API::call(const QUrlQuery& query)
     //if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
 
     QJsonObject result = makeApiCall(query);
-    m_errorCode = getErrorCode(result);
+    updateErrorCode(result);
     return result;
 }
 
@@ -92,220 +132,82 @@ QJsonObject API::call(const QUrlQuery& query)
 
 EtherBalance API::getEtherBalance(const QString& address, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("account") },
-        { QLatin1String("action"),     QLatin1String("balance") },
-        { QLatin1String("tag"),        tagToString(tag) },
-        { QLatin1String("address"),    address }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EtherBalance>(makeApiCall(query));
+    return fetch<Endpoints::Balance>(tagToString(tag),address);
 }
 
 AccountBalanceList API::getEtherBalance(const QStringList& addresses, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("account") },
-        { QLatin1String("action"),     QLatin1String("balancemulti") },
-        { QLatin1String("tag"),        tagToString(tag) },
-        { QLatin1String("address"),    addresses.join(",") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<AccountBalanceList>(makeApiCall(query));
+    return fetch<Endpoints::BalanceMulti>(tagToString(tag),addresses.join(","));
 }
 
 TransactionList API::getListOfNomalTransactions(const QString& address, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("txlist") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset) },
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<TransactionList>(makeApiCall(query));
+    return fetch<Endpoints::TxList>(address,startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 InternalTransactionList API::getListOfInternalTransactions(const QString& address, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("txlistinternal") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset) },
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<InternalTransactionList>(makeApiCall(query));
+    return fetch<Endpoints::TxListInternal>(address,startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 InternalTransactionList API::getListOfInternalTransactions(const QString& txhash)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("txlistinternal") },
-        { QLatin1String("txhash"),          txhash }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<InternalTransactionList>(makeApiCall(query));
+    return fetch<Endpoints::TxListInternalByHash>(txhash);
 }
 
 InternalTransactionList API::getListOfInternalTransactions(qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("txlistinternal") },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)},
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<InternalTransactionList>(makeApiCall(query));
+    return fetch<Endpoints::TxListInternalByBlockRange>(startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 ERC20TokenTransferEventList API::getListOfERC20TokenTransfers(const QString& address, const QString& contractAddress, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("tokentx") },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)},
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
+    QUrlQuery query = endpointQuery<Endpoints::TokenTx>(startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 
     if (!address.isEmpty())         query.addQueryItem(QLatin1String("address"),address);
     if (!contractAddress.isEmpty()) query.addQueryItem(QLatin1String("contractAddress"),contractAddress);
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC20TokenTransferEventList>(makeApiCall(query));
+    return makeObjectApiCall<ERC20TokenTransferEventList>(query,recordFilter<Endpoints::TokenTx>(m_context));
 }
 
 ERC721TokenTransferEventList API::getListOfERC721TokenTransfers(const QString& address, const QString& contractAddress, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("tokennfttx") },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)},
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
+    QUrlQuery query = endpointQuery<Endpoints::TokenNftTx>(startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 
     if (!address.isEmpty())         query.addQueryItem(QLatin1String("address"),address);
     if (!contractAddress.isEmpty()) query.addQueryItem(QLatin1String("contractAddress"),contractAddress);
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC721TokenTransferEventList>(makeApiCall(query));
+    return makeObjectApiCall<ERC721TokenTransferEventList>(query,recordFilter<Endpoints::TokenNftTx>(m_context));
 }
 
 ERC1155TokenTransferEventList API::getListOfERC1155TokenTransfers(const QString& address, const QString& contractAddress, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("token1155tx") },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)},
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
+    QUrlQuery query = endpointQuery<Endpoints::Token1155Tx>(startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 
     if (!address.isEmpty())         query.addQueryItem(QLatin1String("address"),address);
     if (!contractAddress.isEmpty()) query.addQueryItem(QLatin1String("contractAddress"),contractAddress);
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC1155TokenTransferEventList>(makeApiCall(query));
+    return makeObjectApiCall<ERC1155TokenTransferEventList>(query,recordFilter<Endpoints::Token1155Tx>(m_context));
 }
 
 BlockList API::getListOfBlocksMinedByAddress(const QString& address, BlockType blockType, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("getminedblocks") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset) },
-        { QLatin1String("blocktype"),       (blockType == UnclesType) ? QLatin1String("uncles") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<BlockList>(makeApiCall(query));
+    return fetch<Endpoints::GetMinedBlocks>(address,page,offset,(blockType == UnclesType) ? QLatin1String("uncles") : QLatin1String("desc"));
 }
 
 BlockList API::getListOfBlocksValidatedByAddress(const QString& address, BlockType blockType, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("getminedblocks") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset) },
-        { QLatin1String("blocktype"),       (blockType == UnclesType) ? QLatin1String("uncles") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<BlockList>(makeApiCall(query));
+    return fetch<Endpoints::GetMinedBlocks>(address,page,offset,(blockType == UnclesType) ? QLatin1String("uncles") : QLatin1String("desc"));
 }
 
 BeaconChainWithdrawalList API::getBeaconChainWithdrawals(const QString& address, qint32 startBlock, qint32 endBlock, int page, int offset, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("txsBeaconWithdrawal") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("startblock"),      QString::number(startBlock) },
-        { QLatin1String("endblock"),        QString::number(endBlock) },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)},
-        { QLatin1String("sort"),            (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<BeaconChainWithdrawalList>(makeApiCall(query));
+    return fetch<Endpoints::TxsBeaconWithdrawal>(address,startBlock,endBlock,page,offset,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 EtherBalance API::getHistoricalEtherBalance(const QString& address, qint32 blockNumber)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("balancehistory") },
-        { QLatin1String("address"),         address },
-        { QLatin1String("blockno"),         QString::number(blockNumber) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EtherBalance>(makeApiCall(query));
+    return fetch<Endpoints::BalanceHistory>(address,blockNumber);
 }
 
 /*
@@ -317,16 +219,10 @@ EtherBalance API::getHistoricalEtherBalance(const QString& address, qint32 block
 
 QJsonArray API::getContratABI(const QString& address)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("contract") },
-        { QLatin1String("action"),          QLatin1String("getabi") },
-        { QLatin1String("address"),         address }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
+    QUrlQuery query = endpointQuery<Endpoints::GetAbi>(address);
 
     QJsonObject response = makeApiCall(query);
-    m_errorCode = getErrorCode(response);
+    updateErrorCode(response);
     if (m_errorCode != NoError)
         return QJsonArray();
 
@@ -335,28 +231,12 @@ QJsonArray API::getContratABI(const QString& address)
 
 ContractSourceCode API::getContractSourceCode(const QString& address)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("contract") },
-        { QLatin1String("action"),          QLatin1String("getsourcecode") },
-        { QLatin1String("address"),         address }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ContractSourceCode>(makeApiCall(query));
+    return fetch<Endpoints::GetSourceCode>(address);
 }
 
 ContractCreatorList API::getContractCreatorList(const QStringList& addresses)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),               QLatin1String("contract")               },
-        { QLatin1String("action"),               QLatin1String("getcontractcreation")    },
-        { QLatin1String("contractaddresses"),    addresses.join(',')                     }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ContractCreatorList>(makeApiCall(query));
+    return fetch<Endpoints::GetContractCreation>(addresses.join(','));
 }
 
 
@@ -369,29 +249,15 @@ ContractCreatorList API::getContractCreatorList(const QStringList& addresses)
 
 ContractExecutionStatus API::checkContractExecutionStatus(const QString& txHash)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("transaction")},
-        { QLatin1String("action"),     QLatin1String("getstatus") },
-        { QLatin1String("txhash"),     txHash}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ContractExecutionStatus>(makeApiCall(query));
+    return fetch<Endpoints::GetStatus>(txHash);
 }
 
 bool API::checkTransactionReceiptStatus(const QString& txHash)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("transaction") },
-        { QLatin1String("action"),     QLatin1String("gettxreceiptstatus") },
-        { QLatin1String("txhash"),     txHash }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
+    QUrlQuery query = endpointQuery<Endpoints::GetTxReceiptStatus>(txHash);
 
     QJsonObject response = makeApiCall(query);
-    m_errorCode = getErrorCode(response);
+    updateErrorCode(response);
 
     //According to https://docs.etherscan.io/api-endpoints/stats#check-transaction-receipt-status
     //Tip: The status field returns 0 for failed transactions and 1 for successful transactions.
@@ -407,29 +273,12 @@ bool API::checkTransactionReceiptStatus(const QString& txHash)
 
 BlockAndUncleRewards API::getBlockAndUncleRewards(qint32 blockNumber)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("getblockreward") },
-        { QLatin1String("blockno"),    QString::number(blockNumber)}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<BlockAndUncleRewards>(makeApiCall(query));
-
+    return fetch<Endpoints::GetBlockReward>(blockNumber);
 }
 
 EstimatedBlockCountdown API::getEstimatedBlockCountdown(qint32 blockNumber)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("getblockcountdown") },
-        { QLatin1String("blockno"),    QString::number(blockNumber) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EstimatedBlockCountdown>(makeApiCall(query));
+    return fetch<Endpoints::GetBlockCountdown>(blockNumber);
 }
 
 qint32 API::getBlockNumberByTimestamp(const QDateTime& timestamp,Closest closest)
@@ -439,31 +288,12 @@ qint32 API::getBlockNumberByTimestamp(const QDateTime& timestamp,Closest closest
 
 qint32 API::getBlockNumberByTimestamp(qint64 timestamp,Closest closest)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("getblocknobytime") },
-        { QLatin1String("timestamp"),  QString::number(timestamp) },
-        { QLatin1String("closest"),    (closest == Before) ? QLatin1String("before") : QLatin1String("after") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseInt(makeApiCall(query));
+    return fetch<Endpoints::GetBlockNoByTime>(timestamp,(closest == Before) ? QLatin1String("before") : QLatin1String("after"));
 }
 
 DailyBlockSizeList API::getDailyAverageBlockSize(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("dailyavgblocksize") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyBlockSizeList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgBlockSize>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyBlockSizeList API::getDailyAverageBlockSize(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -473,17 +303,7 @@ DailyBlockSizeList API::getDailyAverageBlockSize(const QDate& startDate, const Q
 
 DailyBlockCountRewardsList API::getDailyBlockCountRewards(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("dailyblkcount") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyBlockCountRewardsList>(makeApiCall(query));
+    return fetch<Endpoints::DailyBlkCount>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyBlockCountRewardsList API::getDailyBlockCountRewards(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -493,17 +313,7 @@ DailyBlockCountRewardsList API::getDailyBlockCountRewards(const QDate& startDate
 
 DailyBlockRewardsList API::getDailyBlockRewards(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("dailyblockrewards") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyBlockRewardsList>(makeApiCall(query));
+    return fetch<Endpoints::DailyBlockRewards>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyBlockRewardsList API::getDailyBlockRewards(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -513,17 +323,7 @@ DailyBlockRewardsList API::getDailyBlockRewards(const QDate& startDate, const QD
 
 DailyBlockTimeList API::getDailyAverageTimeForBlock(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("dailyavgblocktime") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyBlockTimeList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgBlockTime>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyBlockTimeList API::getDailyAverageTimeForBlock(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -533,17 +333,7 @@ DailyBlockTimeList API::getDailyAverageTimeForBlock(const QDate& startDate, cons
 
 DailyUncleCountRewardsList API::getDailyUncleCountRewards(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("block") },
-        { QLatin1String("action"),     QLatin1String("dailyuncleblkcount") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyUncleCountRewardsList>(makeApiCall(query));
+    return fetch<Endpoints::DailyUncleBlkCount>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyUncleCountRewardsList API::getDailyUncleCountRewards(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -560,58 +350,27 @@ DailyUncleCountRewardsList API::getDailyUncleCountRewards(const QDate& startDate
 
 EventLogList API::getEventLogs(const QString& address, qint32 fromBlock, qint32 toBlock, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("logs") },
-        { QLatin1String("action"),     QLatin1String("getLogs") },
-        { QLatin1String("address"),    address },
-        { QLatin1String("fromBlock"),  QString::number(fromBlock) },
-        { QLatin1String("toBlock"),    QString::number(toBlock) },
-        { QLatin1String("page"),       QString::number(page) },
-        { QLatin1String("offset"),     QString::number(offset) },
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EventLogList>(makeApiCall(query));
+    return fetch<Endpoints::GetLogs>(address,fromBlock,toBlock,page,offset);
 }
 
 EventLogList API::getEventLogsByTopics(const QMap<QString,QString>& topics, qint32 fromBlock, qint32 toBlock, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("logs") },
-        { QLatin1String("action"),     QLatin1String("getLogs") },
-        { QLatin1String("fromBlock"),  QString::number(fromBlock) },
-        { QLatin1String("toBlock"),    QString::number(toBlock) },
-        { QLatin1String("page"),       QString::number(page) },
-        { QLatin1String("offset"),     QString::number(offset) },
-    });
+    QUrlQuery query = endpointQuery<Endpoints::GetLogsByTopics>(fromBlock,toBlock,page,offset);
 
     for (auto i = topics.constBegin(); i != topics.constEnd(); i++)
         query.addQueryItem(i.key(),i.value());
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EventLogList>(makeApiCall(query));
+    return makeObjectApiCall<EventLogList>(query,recordFilter<Endpoints::GetLogsByTopics>(m_context));
 }
 
 EventLogList API::getEventLogsByAddressTopics(const QMap<QString,QString>& topics, const QString& address, qint32 fromBlock, qint32 toBlock, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("logs") },
-        { QLatin1String("action"),     QLatin1String("getLogs") },
-        { QLatin1String("address"),    address },
-        { QLatin1String("fromBlock"),  QString::number(fromBlock) },
-        { QLatin1String("toBlock"),    QString::number(toBlock) },
-        { QLatin1String("page"),       QString::number(page) },
-        { QLatin1String("offset"),     QString::number(offset) },
-    });
+    QUrlQuery query = endpointQuery<Endpoints::GetLogs>(address,fromBlock,toBlock,page,offset);
 
     for (auto i = topics.constBegin(); i != topics.constEnd(); i++)
         query.addQueryItem(i.key(),i.value());
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EventLogList>(makeApiCall(query));
+    return makeObjectApiCall<EventLogList>(query,recordFilter<Endpoints::GetLogs>(m_context));
 }
 
 /*
@@ -623,28 +382,12 @@ EventLogList API::getEventLogsByAddressTopics(const QMap<QString,QString>& topic
 
 Proxy::BlockNumberResponse API::eth_blockNumber()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_blockNumber") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::BlockNumberResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthBlockNumber>();
 }
 
 Proxy::BlockResponse API::eth_getBlockByNumber(const QString blockNumberString, bool boolean)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getBlockByNumber") },
-        { QLatin1String("tag"),        blockNumberString },
-        { QLatin1String("boolean"),    (boolean) ? QLatin1String("true") : QLatin1String("false") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::BlockResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetBlockByNumber>(blockNumberString,(boolean) ? QLatin1String("true") : QLatin1String("false"));
 }
 
 Proxy::BlockResponse API::eth_getBlockByNumber(qint32 blockNumber, bool boolean)
@@ -652,18 +395,19 @@ Proxy::BlockResponse API::eth_getBlockByNumber(qint32 blockNumber, bool boolean)
     return eth_getBlockByNumber(Proxy::Helper::intToEthString(blockNumber),boolean);
 }
 
-Proxy::BlockResponse API::eth_getUncleByBlockNumberAndIndex(const QString& blockNumberString,const QString& indexString)
+QList<Proxy::BlockResponse> API::eth_getBlocksByNumber(const QList<qint32>& blockNumbers, bool boolean)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getUncleByBlockNumberAndIndex") },
-        { QLatin1String("tag"),        blockNumberString },
-        { QLatin1String("index"),      indexString }
-    });
+    QList<QUrlQuery> queries;
+    queries.reserve(blockNumbers.size());
+    for (qint32 blockNumber : blockNumbers)
+        queries.append(endpointQuery<Endpoints::EthGetBlockByNumber>(Proxy::Helper::intToEthString(blockNumber),boolean));
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
+    return proxyResponseList<Proxy::BlockResponse>(makeBatchApiCall<Endpoints::EthGetBlockByNumber>(queries));
+}
 
-    return proxyResponse<Proxy::BlockResponse>(makeApiCall(query));
+Proxy::BlockResponse API::eth_getUncleByBlockNumberAndIndex(const QString& blockNumberString,const QString& indexString)
+{
+    return fetch<Endpoints::EthGetUncleByBlockNumberAndIndex>(blockNumberString,indexString);
 }
 
 Proxy::BlockResponse API::eth_getUncleByBlockNumberAndIndex(qint32 blockNumber,int index)
@@ -674,15 +418,7 @@ Proxy::BlockResponse API::eth_getUncleByBlockNumberAndIndex(qint32 blockNumber,i
 
 Proxy::TransactionCountResponse API::eth_getBlockTransactionCountByNumber(const QString& blockNumberString)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getBlockTransactionCountByNumber") },
-        { QLatin1String("tag"),        blockNumberString }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::TransactionCountResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetBlockTransactionCountByNumber>(blockNumberString);
 }
 
 Proxy::TransactionCountResponse API::eth_getBlockTransactionCountByNumber(qint32 blockNumber)
@@ -692,29 +428,12 @@ Proxy::TransactionCountResponse API::eth_getBlockTransactionCountByNumber(qint32
 
 Proxy::TransactionResponse API::eth_getTransactionByHash(const QString& txHash)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getTransactionByHash") },
-        { QLatin1String("txhash"),     txHash }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::TransactionResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetTransactionByHash>(txHash);
 }
 
 Proxy::TransactionResponse API::eth_getTransactionByBlockNumberAndIndex(const QString& blockNumber, const QString& index)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getTransactionByBlockNumberAndIndex") },
-        { QLatin1String("tag"),        blockNumber },
-        { QLatin1String("index"),      index }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::TransactionResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetTransactionByBlockNumberAndIndex>(blockNumber,index);
 }
 
 Proxy::TransactionResponse API::eth_getTransactionByBlockNumberAndIndex(qint32 blockNumber, qint32 index)
@@ -725,116 +444,52 @@ Proxy::TransactionResponse API::eth_getTransactionByBlockNumberAndIndex(qint32 b
 
 Proxy::TransactionCountResponse API::eth_getTransactionCount(const QString& address, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getTransactionCount") },
-        { QLatin1String("address"),    address },
-        { QLatin1String("tag"),        tagToString(tag) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::TransactionCountResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetTransactionCount>(address,tagToString(tag));
 }
 
 Proxy::TransactionHashResponse API::eth_sendRawTransaction(const QString& hex)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_sendRawTransaction") },
-        { QLatin1String("hex"),        hex }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::TransactionHashResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthSendRawTransaction>(hex);
 }
 
 Proxy::TransactionReceiptResponse API::eth_getTransactionReceipt(const QString& txHash)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getTransactionReceipt") },
-        { QLatin1String("txhash"),     txHash }
-    });
+    return fetch<Endpoints::EthGetTransactionReceipt>(txHash);
+}
 
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
+QList<Proxy::TransactionReceiptResponse> API::eth_getTransactionReceipts(const QStringList& txHashes)
+{
+    QList<QUrlQuery> queries;
+    queries.reserve(txHashes.size());
+    for (const QString& txHash : txHashes)
+        queries.append(endpointQuery<Endpoints::EthGetTransactionReceipt>(txHash));
 
-    return proxyResponse<Proxy::TransactionReceiptResponse>(makeApiCall(query));
+    return proxyResponseList<Proxy::TransactionReceiptResponse>(makeBatchApiCall<Endpoints::EthGetTransactionReceipt>(queries));
 }
 
 Proxy::StringResponse API::eth_call(const QString& to, const QString& data, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_call") },
-        { QLatin1String("to"),         to },
-        { QLatin1String("data"),       data },
-        { QLatin1String("tag"),        tagToString(tag) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::StringResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthCall>(to,data,tagToString(tag));
 }
 
 Proxy::StringResponse API::eth_getCode(const QString& address, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getCode") },
-        { QLatin1String("address"),    address },
-        { QLatin1String("tag"),        tagToString(tag) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::StringResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetCode>(address,tagToString(tag));
 }
 
 Proxy::StringResponse API::eth_getStorageAt(const QString& address, const QString& positionString, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_getCode") },
-        { QLatin1String("address"),    address },
-        { QLatin1String("position"),   positionString },
-        { QLatin1String("tag"),        tagToString(tag) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::StringResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGetStorageAt>(address,positionString,tagToString(tag));
 }
 
 Proxy::GasPriceResponse API::eth_gasPrice()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_gasPrice") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::GasPriceResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthGasPrice>();
 }
 
 Proxy::StringResponse API::eth_estimateGas(const QString& data, const QString& to,const QString& value,const QString& gasPrice, const QString& gas)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("proxy") },
-        { QLatin1String("action"),     QLatin1String("eth_estimateGas") },
-        { QLatin1String("data"),       data },
-        { QLatin1String("to"),         to },
-        { QLatin1String("value"),      value },
-        { QLatin1String("gasPrice"),   gasPrice},
-        { QLatin1String("gas"),        gas }
-
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return proxyResponse<Proxy::StringResponse>(makeApiCall(query));
+    return fetch<Endpoints::EthEstimateGas>(data,to,value,gasPrice,gas);
 }
 
 Proxy::StringResponse API::eth_estimateGas(const QString& data, const QString& to,const QString& value,quint64 gasPrice, quint64 gas)
@@ -852,133 +507,47 @@ Proxy::StringResponse API::eth_estimateGas(const QString& data, const QString& t
 
 QString API::getERC20TokenTotalSupply(const QString& contractAddress)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("stats") },
-        { QLatin1String("action"),          QLatin1String("tokensupply")},
-        { QLatin1String("contractaddress"), contractAddress}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseString(makeApiCall(query));
+    return fetch<Endpoints::TokenSupply>(contractAddress);
 }
 
 QString API::getERC20TokenAccountBalance(const QString& contractAddress, const QString& address, Tag tag)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("tokenbalance") },
-        { QLatin1String("contractaddress"), contractAddress},
-        { QLatin1String("tag"),             tagToString(tag) },
-        { QLatin1String("address"),         address}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseString(makeApiCall(query));
+    return fetch<Endpoints::TokenBalance>(contractAddress,tagToString(tag),address);
 }
 
 QString API::getHistoricalERC20TokenSupply(const QString& contractAddress, qint32 blockNumber)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("stats") },
-        { QLatin1String("action"),          QLatin1String("tokensupplyhistory") },
-        { QLatin1String("contractaddress"), contractAddress},
-        { QLatin1String("blockno"),         QString::number(blockNumber) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseString(makeApiCall(query));
+    return fetch<Endpoints::TokenSupplyHistory>(contractAddress,blockNumber);
 }
 
 QString API::getHistoricalERC20TokenBalance(const QString& contractAddress, const QString& address, qint32 blockNumber)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("tokenbalancehistory") },
-        { QLatin1String("contractaddress"), contractAddress},
-        { QLatin1String("blockno"),         QString::number(blockNumber) },
-        { QLatin1String("address"),         address}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseString(makeApiCall(query));
+    return fetch<Endpoints::TokenBalanceHistory>(contractAddress,blockNumber,address);
 }
 
 ERC20TokenHolderList API::getERC20TokenHolders(const QString& contractAddress, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("token") },
-        { QLatin1String("action"),          QLatin1String("tokenholderlist") },
-        { QLatin1String("contractaddress"), contractAddress },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC20TokenHolderList>(makeApiCall(query));
+    return fetch<Endpoints::TokenHolderList>(contractAddress,page,offset);
 }
 
 TokenInfo API::getTokenInfo(const QString& contractAddress)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("token") },
-        { QLatin1String("action"),          QLatin1String("tokeninfo") },
-        { QLatin1String("contractaddress"), contractAddress }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<TokenInfo>(makeApiCall(query));
+    return fetch<Endpoints::TokenInfo>(contractAddress);
 }
 
 ERC20TokenHoldingList API::getERC20TokenHolding(const QString& address, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("addresstokenbalance") },
-        { QLatin1String("address"), address },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC20TokenHoldingList>(makeApiCall(query));
+    return fetch<Endpoints::AddressTokenBalance>(address,page,offset);
 }
 
 ERC721TokenHoldingList API::getERC721TokenHolding(const QString& address, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("addresstokennftbalance") },
-        { QLatin1String("address"), address },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC721TokenHoldingList>(makeApiCall(query));
+    return fetch<Endpoints::AddressTokenNftBalance>(address,page,offset);
 }
 
 ERC721TokenInventoryList API::getERC721TokenInventory(const QString& address,const QString& contractAddress, int page, int offset)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),          QLatin1String("account") },
-        { QLatin1String("action"),          QLatin1String("addresstokennftinventory") },
-        { QLatin1String("contractaddress"), contractAddress },
-        { QLatin1String("address"), address },
-        { QLatin1String("page"),            QString::number(page) },
-        { QLatin1String("offset"),          QString::number(offset)}
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<ERC721TokenInventoryList>(makeApiCall(query));
+    return fetch<Endpoints::AddressTokenNftInventory>(contractAddress,address,page,offset);
 }
 
 /*
@@ -990,42 +559,17 @@ ERC721TokenInventoryList API::getERC721TokenInventory(const QString& address,con
 
 quint32 API::getEstimationOfConfirmationTime(quint64 gasPrice)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("gastracker") },
-        { QLatin1String("action"),     QLatin1String("gasestimate") },
-        { QLatin1String("gaspreice"),  QString::number(gasPrice) }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseInt(makeApiCall(query));
+    return fetch<Endpoints::GasEstimate>(gasPrice);
 }
 
 GasOracle API::getGasOracle()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("gastracker") },
-        { QLatin1String("action"),     QLatin1String("gasoracle") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<GasOracle>(makeApiCall(query));
+    return fetch<Endpoints::GasOracle>();
 }
 
 DailyGasLimitList API::getDailyAverageGasLimit(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailyavggaslimit") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyGasLimitList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgGasLimit>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyGasLimitList API::getDailyAverageGasLimit(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1035,17 +579,7 @@ DailyGasLimitList API::getDailyAverageGasLimit(const QDate& startDate, const QDa
 
 DailyTotalGasList API::getDailyTotalGasAmount(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailygasused") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyTotalGasList>(makeApiCall(query));
+    return fetch<Endpoints::DailyGasUsed>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyTotalGasList API::getDailyTotalGasAmount(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1055,17 +589,7 @@ DailyTotalGasList API::getDailyTotalGasAmount(const QDate& startDate, const QDat
 
 DailyGasPriceList API::getDailyAverageGasPrice(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailyavggasprice") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyGasPriceList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgGasPrice>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyGasPriceList API::getDailyAverageGasPrice(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1082,99 +606,37 @@ DailyGasPriceList API::getDailyAverageGasPrice(const QDate& startDate, const QDa
 
 EtherBalance API::getTotalSupplyOfEther()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("ethsupply") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EtherBalance>(makeApiCall(query));
+    return fetch<Endpoints::EthSupply>();
 }
 
 Ether2Supply API::getTotalSupplyOfEther2()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("ethsupply2") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<Ether2Supply>(makeApiCall(query));
+    return fetch<Endpoints::EthSupply2>();
 }
 
 EtherPrice API::getEtherLastPrice()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("ethprice") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EtherPrice>(makeApiCall(query));
+    return fetch<Endpoints::EthPrice>();
 }
 
 NodesSize API::getEtheriumNodesSize(const QDate& startDate, const QDate& endDate, ClientType clientType, Syncmode syncmode, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("chainsize") },
-        { QLatin1String("startdate"),  startDate.toString(Qt::ISODate) },
-        { QLatin1String("enddate"),    endDate.toString(Qt::ISODate) },
-        { QLatin1String("clienttype"), (clientType == Geth) ? QLatin1String("geth") : QLatin1String("parity") },
-        { QLatin1String("syncmode"),   (syncmode == Default) ? QLatin1String("default") : QLatin1String("archive") },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<NodesSize>(makeApiCall(query));
+    return fetch<Endpoints::ChainSize>(startDate.toString(Qt::ISODate),endDate.toString(Qt::ISODate),(clientType == Geth) ? QLatin1String("geth") : QLatin1String("parity"),(syncmode == Default) ? QLatin1String("default") : QLatin1String("archive"),(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 NodesSize API::getEtheriumNodesSize(const QString& startDate, const QString& endDate, ClientType clientType, Syncmode syncmode, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("chainsize") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("clienttype"), (clientType == Geth) ? QLatin1String("geth") : QLatin1String("parity") },
-        { QLatin1String("syncmode"),   (syncmode == Default) ? QLatin1String("default") : QLatin1String("archive") },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<NodesSize>(makeApiCall(query));
+    return fetch<Endpoints::ChainSize>(startDate,endDate,(clientType == Geth) ? QLatin1String("geth") : QLatin1String("parity"),(syncmode == Default) ? QLatin1String("default") : QLatin1String("archive"),(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 NodesCount API::getTotalNodesCount()
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("nodecount") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<NodesCount>(makeApiCall(query));
+    return fetch<Endpoints::NodeCount>();
 }
 
 DailyTransactionFeesList API::getDailyNetworkTransactionFee(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailytxnfee") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyTransactionFeesList>(makeApiCall(query));
+    return fetch<Endpoints::DailyTxnFee>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyTransactionFeesList API::getDailyNetworkTransactionFee(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1184,17 +646,7 @@ DailyTransactionFeesList API::getDailyNetworkTransactionFee(const QDate& startDa
 
 DailyNewAddressCountList API::getDailyNewAddressCount(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailynewaddress") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyNewAddressCountList>(makeApiCall(query));
+    return fetch<Endpoints::DailyNewAddress>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyNewAddressCountList API::getDailyNewAddressCount(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1204,17 +656,7 @@ DailyNewAddressCountList API::getDailyNewAddressCount(const QDate& startDate, co
 
 DailyNetworkUtilizationList API::getDailyNetworkUtilization(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailynetutilization") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyNetworkUtilizationList>(makeApiCall(query));
+    return fetch<Endpoints::DailyNetUtilization>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyNetworkUtilizationList API::getDailyNetworkUtilization(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1224,17 +666,7 @@ DailyNetworkUtilizationList API::getDailyNetworkUtilization(const QDate& startDa
 
 DailyNetworkHashrateList API::getDailyNetworkHashrate(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailyavghashrate") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyNetworkHashrateList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgHashrate>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyNetworkHashrateList API::getDailyNetworkHashrate(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1244,17 +676,7 @@ DailyNetworkHashrateList API::getDailyNetworkHashrate(const QDate& startDate, co
 
 DailyTransactionCountList API::getDailyTransactionCount(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailytx") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyTransactionCountList>(makeApiCall(query));
+    return fetch<Endpoints::DailyTx>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyTransactionCountList API::getDailyTransactionCount(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1264,17 +686,7 @@ DailyTransactionCountList API::getDailyTransactionCount(const QDate& startDate,
 
 DailyNetworkDifficultyList API::getDailyNetworkDifficulty(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("dailyavgnetdifficulty") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyNetworkDifficultyList>(makeApiCall(query));
+    return fetch<Endpoints::DailyAvgNetDifficulty>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyNetworkDifficultyList API::getDailyNetworkDifficulty(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1284,17 +696,7 @@ DailyNetworkDifficultyList API::getDailyNetworkDifficulty(const QDate& startDate
 
 DailyMarketCapList API::getHistoricalEtherMarketCapitalization(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("ethdailymarketcap") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<DailyMarketCapList>(makeApiCall(query));
+    return fetch<Endpoints::EthDailyMarketCap>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 DailyMarketCapList API::getHistoricalEtherMarketCapitalization(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1304,17 +706,7 @@ DailyMarketCapList API::getHistoricalEtherMarketCapitalization(const QDate& star
 
 EtherHistoricalPriceList API::getEtherHistoricalPrice(const QString& startDate, const QString& endDate, Sort sort)
 {
-    QUrlQuery query({
-        { QLatin1String("module"),     QLatin1String("stats") },
-        { QLatin1String("action"),     QLatin1String("ethdailyprice") },
-        { QLatin1String("startdate"),  startDate },
-        { QLatin1String("enddate"),    endDate },
-        { QLatin1String("sort"),       (sort == Asc) ? QLatin1String("asc") : QLatin1String("desc") }
-    });
-
-    if (!m_apiKey.isEmpty()) query.addQueryItem(QLatin1String("apikey"),m_apiKey);
-
-    return responseObject<EtherHistoricalPriceList>(makeApiCall(query));
+    return fetch<Endpoints::EthDailyPrice>(startDate,endDate,(sort == Asc) ? QLatin1String("asc") : QLatin1String("desc"));
 }
 
 EtherHistoricalPriceList API::getEtherHistoricalPrice(const QDate& startDate, const QDate& endDate, Sort sort)
@@ -1322,6 +714,57 @@ EtherHistoricalPriceList API::getEtherHistoricalPrice(const QDate& startDate, co
     return getEtherHistoricalPrice(startDate.toString(Qt::ISODate),endDate.toString(Qt::ISODate),sort);
 }
 
+/*
+ **********************************************************************************************************************
+ *
+ * Subscriptions
+ *
+ */
+
+Subscription* API::subscribe(const QUrlQuery& query, quint32 intervalMsec, QObject* parent)
+{
+    // API key is not a part of the topic, poller adds current key before each request
+    QUrlQuery topicQuery(query);
+    topicQuery.removeAllQueryItems(QLatin1String("apikey"));
+
+    // Network is resolved once, so poller does not follow later API::setEtheriumNetwork calls and each network has
+    // single poller of the topic
+    const Network network = requestNetwork(m_context);
+    RequestContext context;
+    context.setNetwork(network);
+    const QString key = ResponseCache::key(topicQuery,QString::number(chainId(network)));
+
+    SubscriptionPoller* poller = m_pollers.value(key,nullptr);
+    if (poller == nullptr) {
+        poller = new SubscriptionPoller(this,key,topicQuery,context);
+        m_pollers.insert(key,poller);
+    }
+
+    Subscription* subscription = new Subscription(intervalMsec,parent);
+    poller->addSubscription(subscription);
+    return subscription;
+}
+
+Subscription* API::subscribeGasOracle(quint32 intervalMsec, QObject* parent)
+{
+    return subscribe(endpointQuery<Endpoints::GasOracle>(),intervalMsec,parent);
+}
+
+Subscription* API::subscribeBlockNumber(quint32 intervalMsec, QObject* parent)
+{
+    return subscribe(endpointQuery<Endpoints::EthBlockNumber>(),intervalMsec,parent);
+}
+
+Subscription* API::subscribeEtherLastPrice(quint32 intervalMsec, QObject* parent)
+{
+    return subscribe(endpointQuery<Endpoints::EthPrice>(),intervalMsec,parent);
+}
+
+Subscription* API::subscribeEtherBalance(const QString& address, quint32 intervalMsec, QObject* parent)
+{
+    return subscribe(endpointQuery<Endpoints::Balance>(tagToString(Latest),address),intervalMsec,parent);
+}
+
 /*
  **********************************************************************************************************************
  *
@@ -1331,54 +774,464 @@ EtherHistoricalPriceList API::getEtherHistoricalPrice(const QDate& startDate, co
 
 QJsonObject API::makeApiCall(const QUrlQuery& urlQuery)
 {
-    qDebug() << m_net.request(urlQuery);
-    return QJsonDocument::fromJson(m_net.request(urlQuery)).object();
+    m_fromEtherscan = !isJsonRpcQuery(urlQuery,m_context);
+
+    QUrlQuery query(urlQuery);
+    const RequestContext context = resolveNetwork(m_context,&query);
+
+    if (!m_cachePolicy.isCached(query))
+        return fetchResponse(query,context);
+
+    // Each network has its own cache namespace
+    const QString cacheKey = ResponseCache::key(query,QString::number(chainId(requestNetwork(context))));
+    QJsonObject cached;
+    switch (m_cache.lookup(cacheKey,m_cachePolicy.softTtl(query),m_cachePolicy.hardTtl(query),&cached)) {
+    case ResponseCache::Stale:
+        refreshInBackground(query,context,cacheKey);
+        Q_FALLTHROUGH();
+    case ResponseCache::Fresh:
+        m_requestStatus = Networking::RequestFinished;
+        m_fromEtherscan = false;
+        return cached;
+    case ResponseCache::Missing:
+        break;
+    }
+
+    // Background refresh of this entry may still be in flight, when hard TTL expires. It is joined, not duplicated.
+    if (m_cache.isRefreshing(cacheKey)) {
+        waitForRefresh(cacheKey,context);
+        if (m_cache.lookup(cacheKey,m_cachePolicy.softTtl(query),m_cachePolicy.hardTtl(query),&cached) != ResponseCache::Missing) {
+            m_requestStatus = Networking::RequestFinished;
+            m_fromEtherscan = false;
+            return cached;
+        }
+    }
+
+    QJsonObject response = fetchResponse(query,context);
+    if (isCacheableResponse(response))
+        m_cache.insert(cacheKey,response);
+
+    return response;
 }
 
-template<class C>
-C API::responseObject(const QJsonObject& response)
+QJsonObject API::fetchResponse(const QUrlQuery& urlQuery, const RequestContext& context)
 {
-    m_errorCode = getErrorCode(response);
-    return (m_errorCode == NoError) ? C(response.value("result")) : C();
+    if (!isJsonRpcQuery(urlQuery,context))
+        return QJsonDocument::fromJson(m_net.request(urlQuery,context,&m_requestStatus)).object();
+
+    const QByteArray body = QJsonDocument(JsonRpc::requestFromQuery(urlQuery,1)).toJson(QJsonDocument::Compact);
+    return QJsonDocument::fromJson(m_net.requestJsonRpc(m_jsonRpcUrl,body,context,&m_requestStatus)).object();
 }
 
-template<class C>
-C API::proxyResponse(const QJsonObject& response)
+bool API::fetchRawResponse(const QUrlQuery& urlQuery, QByteArray* data)
 {
-    m_errorCode = getErrorCode(response);
-    return (m_errorCode == NoError) ? C(response) : C();
+    // Cached actions and JSON-RPC calls need QJsonObject, so they are handled by makeApiCall
+    if (isJsonRpcQuery(urlQuery,m_context) || m_cachePolicy.isCached(urlQuery))
+        return false;
+
+    m_fromEtherscan = true;
+
+    QUrlQuery query(urlQuery);
+    const RequestContext context = resolveNetwork(m_context,&query);
+    *data = m_net.request(query,context,&m_requestStatus);
+    return true;
+}
+
+QJsonObject API::filteredResponse(const QJsonObject& response, const RecordFilter& filter)
+{
+    const QJsonValue result = response.value(QLatin1String("result"));
+    if (filter.isEmpty() || !result.isArray())
+        return response;
+
+    QJsonArray accepted;
+    for (const QJsonValue& value : result.toArray()) {
+        if (filter.accepts(value.toObject()))
+            accepted.append(value);
+    }
+
+    QJsonObject filtered(response);
+    filtered.insert(QLatin1String("result"),accepted);
+    return filtered;
+}
+
+API::Network API::requestNetwork(const RequestContext& context) const
+{
+    return context.hasNetwork() ? static_cast<Network>(context.network()) : m_activeEtheriumNetwork;
+}
+
+RequestContext API::resolveNetwork(const RequestContext& context, QUrlQuery* urlQuery) const
+{
+    RequestContext result(context);
+    const Network network = requestNetwork(context);
+
+    if (m_multichainApi) {
+        urlQuery->removeAllQueryItems(QLatin1String("chainid"));
+        urlQuery->addQueryItem(QLatin1String("chainid"),QString::number(chainId(network)));
+    } else if (network != m_activeEtheriumNetwork) {
+        result.setApiUrl(networkUrl(network));
+    }
+
+    return result;
+}
+
+QList<QJsonObject> API::makeBatchApiCall(const QList<QUrlQuery>& urlQueries, bool jsonRpcBatch)
+{
+    QList<QJsonObject> result;
+    result.reserve(urlQueries.size());
+
+    if (!jsonRpcBatch || urlQueries.isEmpty() || !isJsonRpcQuery(urlQueries.first(),m_context)) {
+        // Etherscan API servers do not support batches, so each call is made separately
+        for (const QUrlQuery& query : urlQueries)
+            result.append(makeApiCall(query));
+        return result;
+    }
+
+    m_fromEtherscan = false;
+    for (int first = 0; first < urlQueries.size(); first += m_jsonRpcBatchSize) {
+        const int count = qMin(m_jsonRpcBatchSize,urlQueries.size() - first);
+
+        // Ids of the calls are their indexes within the batch
+        QJsonArray batch;
+        for (int i = 0; i < count; i++)
+            batch.append(JsonRpc::requestFromQuery(urlQueries.at(first + i),i));
+
+        const QByteArray reply = m_net.requestJsonRpc(m_jsonRpcUrl,QJsonDocument(batch).toJson(QJsonDocument::Compact),
+                                                      m_context,&m_requestStatus);
+        result.append(JsonRpc::splitBatchReply(reply,count));
+    }
+
+    return result;
+}
+
+PendingRequest* API::sendRequest(QUrlQuery urlQuery, RequestContext context, const ResponseCallback& callback)
+{
+    return sendRequestWithStatus(urlQuery,context,[callback](const QJsonObject& response, Networking::RequestStatus) {
+        callback(response);
+    });
+}
+
+PendingRequest* API::sendRequestWithStatus(QUrlQuery urlQuery, RequestContext context, const StatusResponseCallback& callback)
+{
+    // Failed requests are reported with empty QJsonObject
+    const bool fromEtherscan = !isJsonRpcQuery(urlQuery,context);
+    return sendRawRequest(urlQuery,context,[this,callback,fromEtherscan](const QByteArray& data,
+                                                                        Networking::RequestStatus status) {
+        const QJsonObject response = (status == Networking::RequestFinished) ? QJsonDocument::fromJson(data).object()
+                                                                              : QJsonObject();
+        if (fromEtherscan)
+            reportLoad(responseError(response,status),status);
+        callback(response,status);
+    });
+}
+
+PendingRequest* API::sendRawRequest(QUrlQuery urlQuery, RequestContext context, const Networking::RequestCallback& onFinished)
+{
+    context = resolveNetwork(context,&urlQuery);
+
+    if (!isJsonRpcQuery(urlQuery,context))
+        return m_net.send(urlQuery,context,onFinished);
+
+    return sendJsonRpcRequest(m_jsonRpcUrl,urlQuery,context,onFinished);
+}
+
+PendingRequest* API::sendJsonRpcRequest(const QUrl& url, const QUrlQuery& urlQuery, const RequestContext& context,
+                                        const Networking::RequestCallback& onFinished)
+{
+    const QByteArray body = QJsonDocument(JsonRpc::requestFromQuery(urlQuery,1)).toJson(QJsonDocument::Compact);
+    return m_net.sendJsonRpc(url,body,context,onFinished);
+}
+
+PendingRequest* API::makeAsyncCachedApiCall(const QUrlQuery& urlQuery, const RequestContext& context,
+                                            const StatusResponseCallback& callback)
+{
+    if (!m_cachePolicy.isCached(urlQuery))
+        return sendRequestWithStatus(urlQuery,context,callback);
+
+    // Cached replies are used in the same way as by blocking calls (see API::makeApiCall)
+    QUrlQuery query(urlQuery);
+    const RequestContext resolvedContext = resolveNetwork(context,&query);
+    const QString cacheKey = ResponseCache::key(query,QString::number(chainId(requestNetwork(resolvedContext))));
+    QJsonObject cached;
+    switch (m_cache.lookup(cacheKey,m_cachePolicy.softTtl(query),m_cachePolicy.hardTtl(query),&cached)) {
+    case ResponseCache::Stale:
+        refreshInBackground(query,resolvedContext,cacheKey);
+        Q_FALLTHROUGH();
+    case ResponseCache::Fresh:
+        callback(cached,Networking::RequestFinished);
+        return nullptr;
+    case ResponseCache::Missing:
+        break;
+    }
+
+    return sendRequestWithStatus(urlQuery,context,[this,cacheKey,callback](const QJsonObject& response,
+                                                                           Networking::RequestStatus status) {
+        if (isCacheableResponse(response))
+            m_cache.insert(cacheKey,response);
+        callback(response,status);
+    });
+}
+
+bool API::isJsonRpcQuery(const QUrlQuery& urlQuery, const RequestContext& context) const
+{
+    // JSON-RPC node serves single chain, so requests for other networks go to etherscan.io
+    return !m_jsonRpcUrl.isEmpty() && urlQuery.queryItemValue(QLatin1String("module")) == QLatin1String("proxy")
+            && requestNetwork(context) == m_activeEtheriumNetwork;
+}
+
+QUrlQuery API::authenticatedQuery(QUrlQuery urlQuery) const
+{
+    if (!m_apiKey.isEmpty()) urlQuery.addQueryItem(QLatin1String("apikey"),m_apiKey);
+
+    return urlQuery;
+}
+
+PendingRequest* API::makeAsyncApiCall(const QUrlQuery& urlQuery, const RequestContext& context, const ResponseCallback& callback)
+{
+    return sendRequest(authenticatedQuery(urlQuery),context,callback);
+}
+
+PendingRequest* API::asyncGetBlockByNumber(qint32 blockNumber, bool fullTransactions, const RequestContext& context, const BlockCallback& callback,
+                                           bool backgroundDecoding)
+{
+    const QUrlQuery urlQuery = endpointQuery<Endpoints::EthGetBlockByNumber>(Proxy::Helper::intToEthString(blockNumber),
+                                                                             fullTransactions);
+
+    // Missing, failed or mismatching block is reported with invalid Proxy::Block object
+    auto decodeBlock = [blockNumber](const QJsonObject& response) {
+        const Proxy::Block block = isSuccessfulResponse(response) ? Proxy::BlockResponse(response).result()
+                                                                  : Proxy::Block();
+        return (block.number() == blockNumber) ? block : Proxy::Block();
+    };
+
+    if (!backgroundDecoding) {
+        return sendRequest(urlQuery,context,[decodeBlock,callback](const QJsonObject& response) {
+            callback(decodeBlock(response));
+        });
+    }
+
+    // Reply is parsed by the thread of global QThreadPool, while network thread is busy with next replies
+    QPointer<API> guard(this);
+    const bool fromEtherscan = !isJsonRpcQuery(urlQuery,context);
+    return sendRawRequest(urlQuery,context,[guard,decodeBlock,callback,fromEtherscan](const QByteArray& data,
+                                                                                     Networking::RequestStatus status) {
+        if (status != Networking::RequestFinished || guard.isNull()) {
+            if (fromEtherscan && !guard.isNull())
+                guard->reportLoad(responseError(QJsonObject(),status),status);
+            callback(Proxy::Block());
+            return;
+        }
+
+        // Reply is classified by the decoding thread, scheduler is notified from the thread of API object
+        std::shared_ptr<Proxy::Block> block = std::make_shared<Proxy::Block>();
+        std::shared_ptr<Error> error = std::make_shared<Error>(NoError);
+        ParallelDecoding::decodeInBackground(guard.data(),[data,block,error,decodeBlock]() {
+            const QJsonObject response = QJsonDocument::fromJson(data).object();
+            *error = responseError(response,Networking::RequestFinished);
+            *block = decodeBlock(response);
+        },[guard,block,error,callback,fromEtherscan]() {
+            if (fromEtherscan && !guard.isNull())
+                guard->reportLoad(*error,Networking::RequestFinished);
+            callback(*block);
+        });
+    });
+}
+
+PendingRequest* API::asyncGetTransactionReceipt(const QString& txHash, const RequestContext& context, const ReceiptCallback& callback)
+{
+    // Missing or failed receipt is reported with invalid Proxy::TransactionReceipt object
+    return sendRequest(endpointQuery<Endpoints::EthGetTransactionReceipt>(txHash),context,[callback](const QJsonObject& response) {
+        callback(isSuccessfulResponse(response) ? Proxy::TransactionReceiptResponse(response).result()
+                                                : Proxy::TransactionReceipt());
+    });
+}
+
+PendingRequest* API::asyncGetBlockReceipts(const QUrl& url, const QString& blockTag, const RequestContext& context, const ReceiptListCallback& callback)
+{
+    // Node might not support eth_getBlockReceipts, failed request is reported with empty list
+    const QUrlQuery urlQuery = endpointQuery<Endpoints::EthGetBlockReceipts>(blockTag);
+
+    return sendJsonRpcRequest(url,urlQuery,context,[callback](const QByteArray& data, Networking::RequestStatus status) {
+        const QJsonObject response = (status == Networking::RequestFinished) ? QJsonDocument::fromJson(data).object()
+                                                                              : QJsonObject();
+        callback(isSuccessfulResponse(response) ? Proxy::TransactionReceiptList(response.value("result"))
+                                                : Proxy::TransactionReceiptList());
+    });
+}
+
+void API::refreshInBackground(const QUrlQuery& urlQuery, const RequestContext& requestContext, const QString& cacheKey)
+{
+    if (m_cache.isRefreshing(cacheKey))
+        return;
+
+    m_cache.setRefreshing(cacheKey,true);
+
+    // Background refresh must not inherit deadline or cancellation token of the caller
+    RequestContext context;
+    if (requestContext.hasPriority())
+        context.setPriority(requestContext.priority());
+    context.setConsumer(requestContext.consumer());
+    context.setNetwork(requestNetwork(requestContext));
+
+    m_refreshRequests.insert(cacheKey,sendRequest(urlQuery,context,[this,cacheKey](const QJsonObject& response) {
+        m_refreshRequests.remove(cacheKey);
+        if (isCacheableResponse(response))
+            m_cache.insert(cacheKey,response);
+        else
+            m_cache.setRefreshing(cacheKey,false);
+    }));
+}
+
+void API::waitForRefresh(const QString& cacheKey, const RequestContext& context)
+{
+    const QPointer<PendingRequest> request = m_refreshRequests.value(cacheKey);
+    if (request.isNull())
+        return;
+
+    // Caller still may stop waiting by its own deadline or cancellation token
+    QEventLoop waitLoop;
+    connect(request.data(), &QObject::destroyed, &waitLoop, &QEventLoop::quit);
+
+    QTimer deadlineTimer;
+    if (!context.deadline().isForever()) {
+        if (context.deadline().hasExpired())
+            return;
+        connect(&deadlineTimer, &QTimer::timeout, &waitLoop, &QEventLoop::quit);
+        deadlineTimer.setSingleShot(true);
+        deadlineTimer.start(std::chrono::milliseconds(context.deadline().remainingTime()));
+    }
+
+    if (context.cancellationToken() != nullptr) {
+        connect(context.cancellationToken(), &CancellationToken::cancelled, &waitLoop, &QEventLoop::quit);
+        if (context.isCancelled())
+            return;
+    }
+
+    waitLoop.exec();
+}
+
+template<class C>
+QList<C> API::proxyResponseList(const QList<QJsonObject>& responses)
+{
+    // API::errorCode reports the first error which has happened
+    QList<C> result;
+    result.reserve(responses.size());
+    Error firstError = NoError;
+    QString firstErrorMessage;
+    for (const QJsonObject& response : responses) {
+        result.append(proxyResponse<C>(response));
+        if (firstError == NoError && m_errorCode != NoError) {
+            firstError = m_errorCode;
+            firstErrorMessage = m_errorMessage;
+        }
+    }
+
+    m_errorCode = firstError;
+    m_errorMessage = firstErrorMessage;
+    return result;
 }
 
 QString API::responseString(const QJsonObject& response)
 {
-    m_errorCode = getErrorCode(response);
+    updateErrorCode(response);
     return m_errorCode == NoError ? response.value("result").toString() : QString();
 }
 
 qint64 API::responseInt(const QJsonObject& response)
 {
-    m_errorCode = getErrorCode(response);
+    updateErrorCode(response);
     return m_errorCode == NoError ? response.value("result").toString().toLongLong() : 0;
 }
 
+void API::updateErrorCode(const QJsonObject& response)
+{
+    m_errorCode = getErrorCode(response);
+
+    // Replies taken from the cache or from JSON-RPC node say nothing about the load of etherscan.io servers
+    if (m_fromEtherscan)
+        reportLoad(m_errorCode,m_requestStatus);
+}
+
+void API::reportLoad(Error error, Networking::RequestStatus status)
+{
+    // Feedback for the adaptive rate control. Called once for each reply received from etherscan.io servers by both
+    // blocking and asynchronous calls.
+    switch (error) {
+    case NoError:
+    case NoRecorsFoundError:
+    case NoTransactionsFoundError:
+        m_net.requestScheduler()->reportSuccess();
+        return;
+    case TimeoutError:
+        // Deadline of the caller's RequestScope may be much tighter than the server needs, so only expiry of the
+        // global request timeout is treated as overload
+        if (status == Networking::RequestTimedOut)
+            m_net.requestScheduler()->reportOverload();
+        return;
+    case NetworkError:
+    case MaxRateError:
+        m_net.requestScheduler()->reportOverload();
+        return;
+    default:
+        return;
+    }
+}
+
+bool API::isSuccessfulResponse(const QJsonObject& response)
+{
+    if (response.value("status").toString() == QLatin1String("1"))
+        return true;
+
+    return response.contains("jsonrpc") && !response.contains("error");
+}
+
+bool API::isCacheableResponse(const QJsonObject& response)
+{
+    // Node replies with null result for unknown objects (e.g. receipt of pending transaction), which may appear later
+    const QJsonValue result = response.value(QLatin1String("result"));
+    return isSuccessfulResponse(response) && !result.isNull() && !result.isUndefined();
+}
+
 API::Error API::getErrorCode(const QJsonObject& jsonObject)
 {
-    if (jsonObject.isEmpty())
-        return NetworkError;
+    return responseError(jsonObject,m_requestStatus,&m_errorMessage);
+}
+
+API::Error API::responseError(const QJsonObject& jsonObject, Networking::RequestStatus status, QString* errorMessage)
+{
+    if (jsonObject.isEmpty()) {
+        switch (status) {
+        case Networking::RequestTimedOut:
+        case Networking::RequestDeadlineExpired:
+            return TimeoutError;
+        case Networking::RequestCancelled:
+            return CancelledError;
+        case Networking::RequestTooLarge:
+            return ReplyTooLargeError;
+        default:
+            return NetworkError;
+        }
+    }
 
     // If we have reply for etherscan API method - we have status field in reply QJsonObject
     if (jsonObject.value("status").toString() == QLatin1String("1"))
         return NoError;
 
     // If we have reply for etherscan geth/parity method - we have "jsonrpc" field in reply QJsonObject
-    if (jsonObject.contains("jsonrpc"))
-        return NoError;
+    if (jsonObject.contains("jsonrpc")) {
+        if (!jsonObject.contains("error"))
+            return NoError;
+
+        if (errorMessage != nullptr)
+            *errorMessage = jsonObject.value("error").toObject().value("message").toString();
+        return JsonRpcError;
+    }
 
     if (jsonObject.value("message").toString() == QLatin1String("No transactions found"))
         return NoTransactionsFoundError;
 
     QString errorString = jsonObject.value("result").toString();
-    m_errorMessage = errorString;
+    if (errorMessage != nullptr)
+        *errorMessage = errorString;
     if (errorString.contains(QLatin1String("Max rate limit reached")))
         return MaxRateError;
 
@@ -27,13 +27,25 @@
 
 #include <QObject>
 
+#include <QJsonDocument>
+
+#include <type_traits>
+#include <utility>
+
+#include "./qethsc_cachepolicy.h"
+#include "./qethsc_cancellationtoken.h"
+#include "./qethsc_endpoints.h"
 #include "./qethsc_networking.h"
+#include "./qethsc_querytemplate.h"
+#include "./qethsc_responsecache.h"
+#include "./qethsc_subscription.h"
 
 #include "./types/qethsc_accountbalance.h"
 #include "./types/qethsc_dailyblocksize.h"
 #include "./types/qethsc_beaconchainwithdrawal.h"
 #include "./types/qethsc_block.h"
 #include "./types/qethsc_blockandunclerewards.h"
+#include "./types/qethsc_columnarlists.h"
 #include "./types/qethsc_contractcreator.h"
 #include "./types/qethsc_contractexecutionstatus.h"
 #include "./types/qethsc_contractsourcecode.h"
@@ -64,6 +76,7 @@
 #include "./types/qethsc_ether2supply.h"
 #include "./types/qethsc_etherhistoricalprice.h"
 #include "./types/qethsc_eventlogs.h"
+#include "./types/qethsc_flatjson.h"
 #include "./types/qethsc_gasoracle.h"
 #include "./types/qethsc_internaltransaction.h"
 #include "./types/qethsc_nodescount.h"
@@ -104,6 +117,12 @@ public:
     enum Error {
         NoError,                       /*!< @brief If the request was successfull */
         NetworkError,                  /*!< @brief If during request some networking error happened */
+        TimeoutError,                  /*!< @brief If request was aborted, because its deadline (set by
+                                        *          API::setRequestTimeout or RequestScope) has expired */
+        CancelledError,                /*!< @brief If request was aborted, because its CancellationToken was
+                                        *          cancelled */
+        ReplyTooLargeError,            /*!< @brief If request was aborted, because its reply exceeded
+                                        *          API::maxReplySize */
 
         NoRecorsFoundError,            /*!< @brief Corresponds to "result":"No records found" */
         NoTransactionsFoundError,      /*!< @brief Corresponds to "message":"No transactions found" */
@@ -118,12 +137,15 @@ public:
         InvalidActionNameError,        /*!< @brief Corresponds to "result":"Error! Missing Or invalid Action name" */
         InvalidParameterError,         /*!< @brief Corresponds to "result":"Error! Missing or invalid parameter" */
 
+        JsonRpcError,                  /*!< @brief If reply of the "proxy" module method or JSON-RPC node contains
+                                        *          "error" object. Its message is returned by API::errorMessage */
+
         UnknownError                   /*!< @brief Corresponds to any other error which have happened */
     };
 
     explicit API(QObject *parent = nullptr);
     explicit API(const QString& apiKey, QObject *parent = nullptr);
-    ~API() {}
+    ~API() { qDeleteAll(m_pollers); }
 
     /*! @brief This method can be used to set Etherscan API token
      *  @details After setting new api key - all requests made to Etherscan servers will be done using this key. For
@@ -143,14 +165,69 @@ public:
     QNetworkProxy  proxy() const                           { return m_net.proxy(); }
 
     /*! @brief This method allows to setup a timeout for requests to Etherscan servers.
+     *  @details This timeout is applied to every single request. For per-call deadlines and cancellation use
+     *           RequestScope. Requests aborted due to timeout are reported with API::TimeoutError.
      *  @param quint32 timeout (in mseconds) after which request will be aborted. Pass 0 to disable timeout */
     void           setRequestTimeout(quint32 msec)         { m_net.setRequestTimeout(msec); }
 
     /*! @brief This method returns information about timeout */
     quint32        requestTimeout() const                  { return m_net.requestTimeout(); }
 
+    /*! @brief This method allows to limit size of the replies from Etherscan servers and JSON-RPC node.
+     *  @details Reply is aborted as soon as its announced or downloaded size exceeds the limit, so huge replies do not
+     *           occupy memory. Such requests are reported with API::ReplyTooLargeError.
+     *  @param qint64 bytes - maximal size of the reply body. Pass 0 to disable limit (default) */
+    void           setMaxReplySize(qint64 bytes)           { m_net.setMaxReplySize(bytes); }
+
+    /*! @brief This method returns maximal size of the reply body. 0 means no limit. */
+    qint64         maxReplySize() const                    { return m_net.maxReplySize(); }
+
+    /*! @brief This method can be used to share one RequestScheduler object (and therefore one rate budget) between
+     *         several API objects living in the same thread.
+     *  @details By default each API object uses its own scheduler, which does not limit rate of the requests. Passing
+     *           nullptr restores this default scheduler. Ownership is not transferred.
+     *  @param RequestScheduler scheduler - scheduler to be used by this API object */
+    void           setRequestScheduler(RequestScheduler* scheduler) { m_net.setRequestScheduler(scheduler); }
+
+    /*! @brief This method returns RequestScheduler used by this API object. It can be used to configure rate limits,
+     *         priorities of the requests and adaptive rate control (RequestScheduler::setAdaptive). */
+    RequestScheduler* requestScheduler() const             { return m_net.requestScheduler(); }
+
+    /*! @brief This method can be used to enable hedged requests for latency-critical actions.
+     *  @details For details check HedgingPolicy class. By default hedging is disabled.
+     *  @param HedgingPolicy policy - new hedging configuration */
+    void           setHedgingPolicy(const HedgingPolicy& policy) { m_net.setHedgingPolicy(policy); }
+
+    /*! @brief This method returns currently used hedging configuration. */
+    HedgingPolicy  hedgingPolicy() const                   { return m_net.hedgingPolicy(); }
+
+    /*! @brief This method returns amount of duplicate requests sent due to hedging. Each such request consumes extra
+     *         etherscan.io quota. */
+    quint64        hedgedRequestCount() const              { return m_net.hedgedRequestCount(); }
+
+    /*! @brief This method returns amount of requests, for which reply to the duplicate request was used. */
+    quint64        hedgeWinCount() const                   { return m_net.hedgeWinCount(); }
+
+    /*! @brief This method resets counters returned by API::hedgedRequestCount and API::hedgeWinCount. */
+    void           resetHedgingStatistics()                { m_net.resetHedgingStatistics(); }
+
+    /*! @brief This method can be used to enable caching of the replies for "latest" data, like gas oracle or ether
+     *         price (stale-while-revalidate).
+     *  @details For details check CachePolicy class. By default CachePolicy::endpointDefaults is used, pass
+     *           CachePolicy() to disable caching. Changing policy does not drop
+     *           already cached replies - use API::clearCache for this.
+     *  @param CachePolicy policy - new caching configuration */
+    void           setCachePolicy(const CachePolicy& policy) { m_cachePolicy = policy; }
+
+    /*! @brief This method returns currently used caching configuration. */
+    CachePolicy    cachePolicy() const                     { return m_cachePolicy; }
+
+    /*! @brief This method drops all cached replies. */
+    void           clearCache()                            { m_cache.clear(); }
+
     /*! @brief This method can be used to setup with what Etherium network this instantce of QtEtherscan object will interact.
-     *         By default QtEtherscan object will use Mainnet as a "target" network
+     *         By default QtEtherscan object will use Mainnet as a "target" network. Network of the single requests
+     *         can be changed by RequestScope.
      *  @param etheriumNetwork represented by one of the values from enum QtEtherscan::Network */
     void           setEtheriumNetwork(Network etheriumNetwork);
 
@@ -158,6 +235,48 @@ public:
      *  @returns QtEtherscan::Network value */
     Network        etheriumNetwork() const                 { return m_activeEtheriumNetwork; }
 
+    /*! @brief This method can be used to send requests for all networks to the single multichain API URL
+     *         (https://api.etherscan.io/v2/api), selecting network with "chainid" parameter. By default separate
+     *         URL of each network is used.
+     *  @param enabled - true to use multichain API */
+    void           setMultichainApi(bool enabled);
+
+    /*! @brief This method returns true if multichain API is used. */
+    bool           isMultichainApi() const                 { return m_multichainApi; }
+
+    /*! @brief This method returns URL of the etherscan.io API for the network. */
+    static QString networkUrl(Network network);
+
+    /*! @brief This method returns chain id of the network (e.g. 1 for Mainnet). */
+    static qint64  chainId(Network network);
+
+    /*! @brief This method can be used to send requests to Etherscan-compatible API server other than the ones
+     *         selected by API::setEtheriumNetwork. Calling API::setEtheriumNetwork afterwards restores standard URL.
+     *  @param url - full URL of the API (e.g. "https://api.etherscan.io/api") */
+    void           setApiUrl(const QString& url)           { m_net.setApiHost(url); }
+
+    /*! @brief This method returns URL to which requests are sent. */
+    QString        apiUrl() const                          { return m_net.apiHost(); }
+
+    /*! @brief This method can be used to send requests of the "proxy" module methods (eth_*) directly to JSON-RPC node
+     *         (e.g. own archive node) instead of etherscan.io servers.
+     *  @details Requests are sent as native JSON-RPC POST requests. Returned objects are the same as for etherscan.io
+     *           servers. Such requests are not limited by RequestScheduler and do not use API key. Node is assumed
+     *           to serve the active network (API::setEtheriumNetwork), so requests made for other networks with
+     *           RequestScope still go to etherscan.io. Passing empty QUrl restores default behaviour.
+     *  @param url - URL of the JSON-RPC endpoint */
+    void           setJsonRpcUrl(const QUrl& url)          { m_jsonRpcUrl = url; }
+
+    /*! @brief This method returns URL of JSON-RPC endpoint used for "proxy" module methods. */
+    QUrl           jsonRpcUrl() const                      { return m_jsonRpcUrl; }
+
+    /*! @brief This method sets maximal amount of calls sent in one JSON-RPC batch request by batch methods (e.g.
+     *         API::eth_getBlocksByNumber). Default value - 100. */
+    void           setJsonRpcBatchSize(int size)           { m_jsonRpcBatchSize = qMax(1,size); }
+
+    /*! @brief This method returns maximal amount of calls sent in one JSON-RPC batch request. */
+    int            jsonRpcBatchSize() const                { return m_jsonRpcBatchSize; }
+
     /*! @brief This method can be used to get information about errors related to Etherscan API.
      *  @details If the last request to etherscan.io servers failed due to whatever reason - this method should return
      *           value from enum QtEtherscan::API::Error which is representing occured error. If the last request was
@@ -178,6 +297,51 @@ public:
      *  @return QJsonObject containing whole reply from etherscan.io servers. */
     QJsonObject call(const QUrlQuery& query);
 
+    /*! @brief Calls endpoint described by descriptor E from QtEtherscan::Endpoints namespace. Values are passed in the
+     *         order of E::parameters and may be QString, QLatin1String, C strings or integers. API key is added by this
+     *         API object. Errors are reported same as for other methods.
+     *  @return Result of the type E::Result. */
+    template<class E, class... Args>
+    typename E::Result fetch(const Args&... values);
+
+    /*! @brief Calls endpoint described by descriptor E, which returns TransactionList, InternalTransactionList,
+     *         ERC20TokenTransferEventList or EventLogList, and returns its result in columnar form. Reply is decoded
+     *         directly into columns without creating row objects. Values are passed same as for API::fetch.
+     *  @code
+     *  QtEtherscan::TransactionColumns transactions = etherscan.fetchColumns<QtEtherscan::Endpoints::TxList>(
+     *      address,0,99999999,1,10000,"asc");
+     *  @endcode */
+    template<class E, class... Args>
+    typename ColumnarListOf<typename E::Result>::type fetchColumns(const Args&... values);
+
+    /*!
+     *********************************************************************************************************************
+     *  @name Subscriptions to periodically polled data. For details check Subscription class.
+     *  @{ */
+
+    /*! @brief Subscribes to the results of API method described by query. Unlike API::call, API key is added by this
+     *         API object before each poll.
+     *  @param query - QUrlQuery populated with propper parameters.
+     *  @param intervalMsec - desired polling interval.
+     *  @param parent - parent of the created Subscription object. Subscription ends when this object is deleted. */
+    Subscription* subscribe(const QUrlQuery& query, quint32 intervalMsec, QObject* parent = nullptr);
+
+    /*! @brief Subscribes to the results of API::getGasOracle method. Result can be converted to GasOracle object. */
+    Subscription* subscribeGasOracle(quint32 intervalMsec, QObject* parent = nullptr);
+
+    /*! @brief Subscribes to the results of API::eth_blockNumber method. Subscription::response can be converted to
+     *         Proxy::BlockNumberResponse object. */
+    Subscription* subscribeBlockNumber(quint32 intervalMsec, QObject* parent = nullptr);
+
+    /*! @brief Subscribes to the results of API::getEtherLastPrice method. Result can be converted to EtherPrice object. */
+    Subscription* subscribeEtherLastPrice(quint32 intervalMsec, QObject* parent = nullptr);
+
+    /*! @brief Subscribes to the results of API::getEtherBalance method for single address. Result can be converted to
+     *         EtherBalance object. */
+    Subscription* subscribeEtherBalance(const QString& address, quint32 intervalMsec, QObject* parent = nullptr);
+
+    /*! @} */
+
     /*!
      *********************************************************************************************************************
      *  @name Implemented API methods from etherscan.io "accounts" module.
@@ -404,6 +568,12 @@ public:
     /*! @overload */
     Proxy::BlockResponse eth_getBlockByNumber(qint32 blockNumber, bool boolean = true);
 
+    /*! @brief Returns information about several blocks. If JSON-RPC endpoint is set by API::setJsonRpcUrl - blocks are
+     *         requested with batch requests of API::jsonRpcBatchSize calls. Otherwise each block is requested separately.
+     *         Returned list has the same order as blockNumbers. Blocks which were not received are invalid.
+     *  @param boolean If true it returns the full transaction objects, if false only the hashes of the transactions. */
+    QList<Proxy::BlockResponse> eth_getBlocksByNumber(const QList<qint32>& blockNumbers, bool boolean = true);
+
     /*! @brief Returns information about a uncle by block number.
      *  @see https://docs.etherscan.io/api-endpoints/geth-parity-proxy#eth_getunclebyblocknumberandindex */
     Proxy::BlockResponse eth_getUncleByBlockNumberAndIndex(const QString& blockNumberString,const QString& indexString);
@@ -441,6 +611,11 @@ public:
      *  @see https://docs.etherscan.io/api-endpoints/geth-parity-proxy#eth_gettransactionreceipt*/
     Proxy::TransactionReceiptResponse eth_getTransactionReceipt(const QString& txHash);
 
+    /*! @brief Returns receipts of several transactions. If JSON-RPC endpoint is set by API::setJsonRpcUrl - receipts
+     *         are requested with batch requests of API::jsonRpcBatchSize calls. Otherwise each receipt is requested
+     *         separately. Returned list has the same order as txHashes. */
+    QList<Proxy::TransactionReceiptResponse> eth_getTransactionReceipts(const QStringList& txHashes);
+
     /*! @brief Executes a new message call immediately without creating a transaction on the block chain.
      *  @see https://docs.etherscan.io/api-endpoints/geth-parity-proxy#eth_call */
     Proxy::StringResponse eth_call(const QString& to, const QString& data, Tag tag = Latest);
@@ -656,23 +831,234 @@ public:
     /*! @} */
 
 private:
+    friend class RequestScope;
+    friend class BlockFollower;
+    friend class BlockReceiptsFetcher;
+    friend class BlockRangeFetcher;
+    friend class SubscriptionPoller;
+    template<class E> friend class EndpointAwaitable;
+
+    typedef std::function<void(const QJsonObject& response)> ResponseCallback;
+    typedef std::function<void(const QJsonObject& response, Networking::RequestStatus status)> StatusResponseCallback;
+    typedef std::function<void(const Proxy::Block& block)>    BlockCallback;
+    typedef std::function<void(const Proxy::TransactionReceipt& receipt)> ReceiptCallback;
+    typedef std::function<void(const Proxy::TransactionReceiptList& receipts)> ReceiptListCallback;
+
     QJsonObject              makeApiCall(const QUrlQuery& urlQuery);
+    QJsonObject              fetchResponse(const QUrlQuery& urlQuery, const RequestContext& context);
+    bool                     fetchRawResponse(const QUrlQuery& urlQuery, QByteArray* data);
+    template<class E>
+    QList<QJsonObject>       makeBatchApiCall(const QList<QUrlQuery>& urlQueries) { return makeBatchApiCall(urlQueries,E::isProxy); }
+    QList<QJsonObject>       makeBatchApiCall(const QList<QUrlQuery>& urlQueries, bool jsonRpcBatch);
+    PendingRequest*          sendRequest(QUrlQuery urlQuery, RequestContext context, const ResponseCallback& callback);
+    PendingRequest*          sendRequestWithStatus(QUrlQuery urlQuery, RequestContext context,
+                                                   const StatusResponseCallback& callback);
+    PendingRequest*          sendRawRequest(QUrlQuery urlQuery, RequestContext context,
+                                            const Networking::RequestCallback& callback);
+    PendingRequest*          sendJsonRpcRequest(const QUrl& url, const QUrlQuery& urlQuery, const RequestContext& context,
+                                                const Networking::RequestCallback& callback);
+    PendingRequest*          makeAsyncCachedApiCall(const QUrlQuery& urlQuery, const RequestContext& context,
+                                                    const StatusResponseCallback& callback);
+    Network                  requestNetwork(const RequestContext& context) const;
+    RequestContext           resolveNetwork(const RequestContext& context, QUrlQuery* urlQuery) const;
+    bool                     isJsonRpcQuery(const QUrlQuery& urlQuery, const RequestContext& context) const;
+    void                     refreshInBackground(const QUrlQuery& urlQuery, const RequestContext& requestContext,
+                                                 const QString& cacheKey);
+    void                     waitForRefresh(const QString& cacheKey, const RequestContext& context);
+    QUrlQuery                authenticatedQuery(QUrlQuery urlQuery) const;
+    PendingRequest*          makeAsyncApiCall(const QUrlQuery& urlQuery, const RequestContext& context,
+                                              const ResponseCallback& callback);
+    PendingRequest*          asyncGetBlockByNumber(qint32 blockNumber, bool fullTransactions,
+                                                   const RequestContext& context, const BlockCallback& callback,
+                                                   bool backgroundDecoding = false);
+    PendingRequest*          asyncGetTransactionReceipt(const QString& txHash, const RequestContext& context,
+                                                        const ReceiptCallback& callback);
+    PendingRequest*          asyncGetBlockReceipts(const QUrl& url, const QString& blockTag,
+                                                   const RequestContext& context, const ReceiptListCallback& callback);
     qint64                   responseInt(const QJsonObject& response);
     QString                  responseString(const QJsonObject& response);
+    template<class E, class... Args>
+    QUrlQuery                endpointQuery(const Args&... values) const;
+    template<class E>
+    typename E::Result       decodeEndpointResponse(const QJsonObject& response, const RequestContext& context);
+    template<class E>
+    typename E::Result       decodeAsyncResponse(const QJsonObject& response, Networking::RequestStatus status,
+                                                 const RequestContext& context, Error* error, QString* errorMessage);
+    template<class E>
+    static RecordFilter      recordFilter(const RequestContext& context);
+    template<class C> C      makeObjectApiCall(const QUrlQuery& urlQuery, const RecordFilter& filter);
+    template<class C> C      makeColumnsApiCall(const QUrlQuery& urlQuery, const RecordFilter& filter);
     template<class C> C      responseObject(const QJsonObject& response);
+    static QJsonObject       filteredResponse(const QJsonObject& response, const RecordFilter& filter);
     template<class C> C      proxyResponse(const QJsonObject& response);
+    template<class C> QList<C> proxyResponseList(const QList<QJsonObject>& responses);
+    void                     updateErrorCode(const QJsonObject& response);
     Error                    getErrorCode(const QJsonObject& response);
+    void                     reportLoad(Error error, Networking::RequestStatus status);
+    static Error             responseError(const QJsonObject& response, Networking::RequestStatus status,
+                                           QString* errorMessage = nullptr);
 
+    static bool              isSuccessfulResponse(const QJsonObject& response);
+    static bool              isCacheableResponse(const QJsonObject& response);
     static QString           tagToString(Tag tag);
 
     Networking     m_net;
     QString        m_apiKey;
     Network        m_activeEtheriumNetwork;
+    bool           m_multichainApi;
+    RequestContext m_context;
+    CachePolicy    m_cachePolicy;
+    ResponseCache  m_cache;
+    QHash<QString,QPointer<PendingRequest>> m_refreshRequests;
+
+    QHash<QString,SubscriptionPoller*> m_pollers;
+
+    QUrl           m_jsonRpcUrl;
+    int            m_jsonRpcBatchSize;
+
+    Networking::RequestStatus m_requestStatus;
+    bool           m_fromEtherscan;
 
     Error          m_errorCode;
     QString        m_errorMessage;
 };
 
+template<class E, class... Args>
+typename E::Result API::fetch(const Args&... values)
+{
+    typedef typename E::Result Result;
+    const QUrlQuery query = endpointQuery<E>(values...);
+
+    if constexpr (FlatJsonDecodable<Result>::value)
+        return makeObjectApiCall<Result>(query,recordFilter<E>(m_context));
+    else
+        return decodeEndpointResponse<E>(makeApiCall(query),m_context);
+}
+
+template<class E>
+typename E::Result API::decodeEndpointResponse(const QJsonObject& response, const RequestContext& context)
+{
+    typedef typename E::Result Result;
+
+    if constexpr (std::is_same_v<Result,QJsonObject>) {
+        updateErrorCode(response);
+        return response;
+    } else if constexpr (std::is_same_v<Result,QString>) {
+        return responseString(response);
+    } else if constexpr (std::is_same_v<Result,qint64>) {
+        return responseInt(response);
+    } else if constexpr (E::isProxy) {
+        return proxyResponse<Result>(response);
+    } else {
+        return responseObject<Result>(filteredResponse(response,recordFilter<E>(context)));
+    }
+}
+
+template<class E>
+typename E::Result API::decodeAsyncResponse(const QJsonObject& response, Networking::RequestStatus status,
+                                            const RequestContext& context, Error* error, QString* errorMessage)
+{
+    // Error of the asynchronous call is returned to its caller, state of the blocking calls is not changed. Load of
+    // etherscan.io servers was already reported, when reply was received (see API::sendRequestWithStatus).
+    const Networking::RequestStatus requestStatus = m_requestStatus;
+    const bool wasFromEtherscan = m_fromEtherscan;
+    const Error errorCode = m_errorCode;
+    const QString message = m_errorMessage;
+
+    m_requestStatus = status;
+    m_fromEtherscan = false;
+    m_errorMessage.clear();
+    typename E::Result result = decodeEndpointResponse<E>(response,context);
+    *error = m_errorCode;
+    *errorMessage = m_errorMessage;
+
+    m_requestStatus = requestStatus;
+    m_fromEtherscan = wasFromEtherscan;
+    m_errorCode = errorCode;
+    m_errorMessage = message;
+    return result;
+}
+
+template<class E>
+RecordFilter API::recordFilter(const RequestContext& context)
+{
+    // Objects are filtered only within pages of the long lists, replies of other endpoints are returned as is
+    return E::isPaged ? context.recordFilter() : RecordFilter();
+}
+
+template<class C>
+C API::makeObjectApiCall(const QUrlQuery& urlQuery, const RecordFilter& filter)
+{
+    // Lists of flat objects are decoded directly from the reply data, if it is possible. Only this path applies field
+    // projection of the RequestScope, fallback to QJsonDocument decodes all fields. Record filter is applied by both.
+    if constexpr (FlatJsonDecodable<C>::value) {
+        QByteArray data;
+        if (fetchRawResponse(urlQuery,&data)) {
+            C result;
+            QJsonObject envelope;
+            if (!decodeFlatJsonList(data,&result,m_context.fields(),filter,m_context.stringPool(),&envelope))
+                return responseObject<C>(filteredResponse(QJsonDocument::fromJson(data).object(),filter));
+
+            updateErrorCode(envelope);
+            return result;
+        }
+    }
+
+    return responseObject<C>(filteredResponse(makeApiCall(urlQuery),filter));
+}
+
+template<class E, class... Args>
+typename ColumnarListOf<typename E::Result>::type API::fetchColumns(const Args&... values)
+{
+    return makeColumnsApiCall<typename ColumnarListOf<typename E::Result>::type>(endpointQuery<E>(values...),
+                                                                                  recordFilter<E>(m_context));
+}
+
+template<class C>
+C API::makeColumnsApiCall(const QUrlQuery& urlQuery, const RecordFilter& filter)
+{
+    typedef typename C::List List;
+
+    QByteArray data;
+    if (fetchRawResponse(urlQuery,&data)) {
+        C result;
+        QJsonObject envelope;
+        if (!decodeFlatJsonColumns(data,&result,m_context.fields(),filter,&envelope))
+            return C(responseObject<List>(filteredResponse(QJsonDocument::fromJson(data).object(),filter)));
+
+        updateErrorCode(envelope);
+        return result;
+    }
+
+    return C(responseObject<List>(filteredResponse(makeApiCall(urlQuery),filter)));
+}
+
+template<class E, class... Args>
+QUrlQuery API::endpointQuery(const Args&... values) const
+{
+    static_assert(sizeof...(Args) == E::parameterCount,"Wrong number of endpoint parameters");
+
+    static const QueryTemplate queryTemplate(E::module,E::action,E::parameters.data(),int(E::parameterCount));
+    return queryTemplate.query({ Endpoints::queryValue(values)... },m_apiKey);
+}
+
+template<class C>
+C API::responseObject(const QJsonObject& response)
+{
+    updateErrorCode(response);
+    return (m_errorCode == NoError) ? C(response.value("result")) : C();
+}
+
+template<class C>
+C API::proxyResponse(const QJsonObject& response)
+{
+    updateErrorCode(response);
+    return (m_errorCode == NoError) ? C(response) : C();
+}
+
 } // namespace QtEtherscan
 
+// RequestScope uses API::Network, so it is included after API class is defined
+#include "./qethsc_requestscope.h"
+
 #endif // QT_ETHERSCAN_API_H
@@ -0,0 +1,398 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_blockfollower.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "qethsc_api.h"
+#include "qethsc_pendingrequest.h"
+
+namespace QtEtherscan {
+
+BlockFollower::BlockFollower(API* api, QObject* parent) :
+    QObject{parent},
+    m_api{api},
+    m_blockTime{12000},
+    m_estimatedBlockTime{12000},
+    m_minimumPollInterval{1000},
+    m_maxConcurrentFetches{4},
+    m_reorgWindow{64},
+    m_fullTransactions{false},
+    m_running{false},
+    m_generation{0},
+    m_head{InvalidBlockNumber},
+    m_nextToFetch{InvalidBlockNumber},
+    m_nextToDeliver{InvalidBlockNumber},
+    m_reportedLag{0},
+    m_lastTimestamp{-1},
+    m_inFlight{0}
+{
+    m_pollTimer.setSingleShot(true);
+    connect(&m_pollTimer, &QTimer::timeout, this, &BlockFollower::pollHead);
+
+    m_retryTimer.setSingleShot(true);
+    connect(&m_retryTimer, &QTimer::timeout, this, &BlockFollower::fetchMissing);
+}
+
+BlockFollower::~BlockFollower()
+{
+    stop();
+}
+
+qint32 BlockFollower::lag() const
+{
+    if (m_head == InvalidBlockNumber || m_nextToDeliver == InvalidBlockNumber)
+        return 0;
+
+    return qMax(0,m_head - m_nextToDeliver + 1);
+}
+
+void BlockFollower::start(qint32 fromBlock)
+{
+    stop();
+
+    m_running = true;
+    m_nextToDeliver = fromBlock;
+    m_nextToFetch = fromBlock;
+    m_sinceHeadChange.start();
+    pollHead();
+}
+
+void BlockFollower::stop()
+{
+    if (!m_running)
+        return;
+
+    m_running = false;
+    m_generation++;
+    m_pollTimer.stop();
+    m_retryTimer.stop();
+    abortRequests();
+
+    m_head = InvalidBlockNumber;
+    m_lastTimestamp = -1;
+    m_reportedLag = 0;
+    m_inFlight = 0;
+    m_retry.clear();
+    m_ready.clear();
+    m_recentHashes.clear();
+    m_reorgChain.clear();
+}
+
+void BlockFollower::abortRequests()
+{
+    // Callbacks of the aborted requests are ignored, as generation was changed.
+    if (!m_headRequest.isNull())
+        m_headRequest->abort();
+    m_headRequest.clear();
+
+    for (const QPointer<PendingRequest>& request : std::as_const(m_blockRequests)) {
+        if (!request.isNull())
+            request->abort();
+    }
+    m_blockRequests.clear();
+}
+
+void BlockFollower::pollHead()
+{
+    if (!m_running || m_api.isNull() || !m_headRequest.isNull())
+        return;
+
+    // Head polls are small and latency-sensitive, so they are not queued behind bulk traffic.
+    RequestContext context;
+    context.setPriority(RequestScheduler::Interactive);
+
+    const quint64 generation = m_generation;
+    QPointer<BlockFollower> guard(this);
+    m_headRequest = m_api->sendRequest(m_api->endpointQuery<Endpoints::EthBlockNumber>(),context,
+                                       [guard,generation](const QJsonObject& response) {
+        if (guard.isNull() || guard->m_generation != generation)
+            return;
+
+        guard->onHead(response);
+    });
+}
+
+void BlockFollower::onHead(const QJsonObject& response)
+{
+    m_headRequest.clear();
+
+    const qint32 head = API::isSuccessfulResponse(response) ? Proxy::BlockNumberResponse(response).blockNumber()
+                                                            : InvalidBlockNumber;
+    if (head != InvalidBlockNumber && head > m_head) {
+        m_head = head;
+        m_sinceHeadChange.restart();
+
+        if (m_nextToDeliver == InvalidBlockNumber) {
+            m_nextToDeliver = head;
+            m_nextToFetch = head;
+        }
+
+        emit headChanged(head);
+        updateLag();
+        fetchMissing();
+    }
+
+    scheduleNextPoll();
+}
+
+void BlockFollower::scheduleNextPoll()
+{
+    // Next block is expected estimatedBlockTime after the last head change. If it is late - polling more often.
+    const qint64 delay = qMax<qint64>(m_minimumPollInterval,
+                                      static_cast<qint64>(m_estimatedBlockTime) - m_sinceHeadChange.elapsed());
+    m_pollTimer.start(static_cast<int>(delay));
+}
+
+void BlockFollower::fetchMissing()
+{
+    // While looking for the fork point blocks above it are not fetched, they will be fetched again anyway.
+    if (!m_running || m_nextToDeliver == InvalidBlockNumber || !m_reorgChain.isEmpty())
+        return;
+
+    // Blocks fetched ahead of the first not delivered block are buffered. Size of this buffer is limited.
+    const qint32 fetchLimit = m_nextToDeliver + 4 * m_maxConcurrentFetches;
+
+    while (m_inFlight < m_maxConcurrentFetches) {
+        if (!m_retry.isEmpty()) {
+            fetchBlock(m_retry.takeFirst());
+            continue;
+        }
+
+        if (m_nextToFetch > m_head || m_nextToFetch >= fetchLimit)
+            return;
+
+        fetchBlock(m_nextToFetch++);
+    }
+}
+
+void BlockFollower::requestBlock(qint32 blockNumber, const RequestContext& context,
+                                 const std::function<void(const Proxy::Block&)>& callback)
+{
+    if (m_api.isNull())
+        return;
+
+    const quint64 generation = m_generation;
+    QPointer<BlockFollower> guard(this);
+    m_blockRequests.removeAll(QPointer<PendingRequest>());
+    m_blockRequests.append(m_api->asyncGetBlockByNumber(blockNumber,m_fullTransactions,context,
+                                                        [guard,generation,callback](const Proxy::Block& block) {
+        if (guard.isNull() || guard->m_generation != generation)
+            return;
+
+        callback(block);
+    }));
+}
+
+void BlockFollower::fetchBlock(qint32 blockNumber)
+{
+    m_inFlight++;
+    requestBlock(blockNumber,RequestContext(),[this,blockNumber](const Proxy::Block& block) {
+        onBlock(blockNumber,block);
+    });
+}
+
+void BlockFollower::onBlock(qint32 blockNumber, const Proxy::Block& block)
+{
+    m_inFlight--;
+
+    // Block requested before reorganization was handled.
+    if (blockNumber < m_nextToDeliver)
+        return;
+
+    if (!block.isValid()) {
+        // Failed block is requested again a bit later, other blocks are not affected.
+        if (!m_retry.contains(blockNumber)) {
+            m_retry.append(blockNumber);
+            std::sort(m_retry.begin(),m_retry.end());
+        }
+        if (!m_retryTimer.isActive())
+            m_retryTimer.start(static_cast<int>(m_minimumPollInterval));
+        return;
+    }
+
+    m_ready.insert(blockNumber,block);
+    deliverReady();
+    fetchMissing();
+}
+
+void BlockFollower::deliverReady()
+{
+    QPointer<BlockFollower> guard(this);
+    const quint64 generation = m_generation;
+
+    while (m_reorgChain.isEmpty() && !m_ready.isEmpty() && m_ready.firstKey() == m_nextToDeliver) {
+        const Proxy::Block block = m_ready.take(m_nextToDeliver);
+
+        // Block which is not a child of the last delivered block means that the chain was reorganized.
+        const auto parent = m_recentHashes.constFind(block.number() - 1);
+        if (parent != m_recentHashes.constEnd() && parent.value() != block.parentHash()) {
+            m_reorgChain.append(block);
+            findForkPoint();
+            return;
+        }
+
+        m_nextToDeliver++;
+        rememberBlock(block);
+
+        // Refining block time estimation using block timestamps.
+        if (m_lastTimestamp > 0 && block.timestampInteger() > m_lastTimestamp) {
+            const double blockTime = 1000.0 * (block.timestampInteger() - m_lastTimestamp);
+            m_estimatedBlockTime = qBound<double>(m_minimumPollInterval,
+                                                  0.8 * m_estimatedBlockTime + 0.2 * blockTime,
+                                                  10.0 * m_blockTime);
+        }
+        m_lastTimestamp = block.timestampInteger();
+
+        emit blockReceived(block);
+
+        // Receiver might have stopped, restarted or deleted this follower.
+        if (guard.isNull() || guard->m_generation != generation)
+            return;
+    }
+
+    updateLag();
+}
+
+void BlockFollower::rememberBlock(const Proxy::Block& block)
+{
+    m_recentHashes.insert(block.number(),block.hash());
+    while (m_recentHashes.size() > m_reorgWindow)
+        m_recentHashes.erase(m_recentHashes.begin());
+}
+
+void BlockFollower::findForkPoint()
+{
+    // Blocks of the new chain are requested one by one going down by parentHash links, until block known to this
+    // follower is found. So amount of requests equals to the depth of the reorganization.
+    const qint32 blockNumber = m_reorgChain.first().number() - 1;
+
+    if (m_recentHashes.isEmpty() || blockNumber < m_recentHashes.firstKey()) {
+        // Reorganization is deeper than the window of remembered blocks. Everything remembered is rolled back.
+        applyReorg(blockNumber);
+        return;
+    }
+
+    RequestContext context;
+    context.setPriority(RequestScheduler::Interactive);
+    requestBlock(blockNumber,context,[this](const Proxy::Block& block) { onForkCandidate(block); });
+}
+
+void BlockFollower::onForkCandidate(const Proxy::Block& block)
+{
+    if (!block.isValid()) {
+        QTimer::singleShot(static_cast<int>(m_minimumPollInterval), this, [this,generation = m_generation]() {
+            if (m_generation == generation && !m_reorgChain.isEmpty())
+                findForkPoint();
+        });
+        return;
+    }
+
+    const bool linked = (m_reorgChain.first().parentHash() == block.hash());
+
+    if (m_recentHashes.value(block.number()) == block.hash()) {
+        if (linked) {
+            applyReorg(block.number());
+            return;
+        }
+
+        // Remembered block is still canonical, but block which triggered the search was fetched from a chain
+        // which is already abandoned, or chain has moved again during the walk. Delivered blocks are kept -
+        // blocks above the last delivered one are fetched again and parentHash check starts the walk from the
+        // new tip, rolling back whatever is not canonical anymore.
+        m_reorgChain.clear();
+        resumeAfter(m_nextToDeliver - 1);
+        return;
+    }
+
+    // Chain has changed once again while we were walking down - building new chain from this block.
+    if (!linked)
+        m_reorgChain.clear();
+
+    m_reorgChain.prepend(block);
+    findForkPoint();
+}
+
+void BlockFollower::applyReorg(qint32 forkBlockNumber)
+{
+    QPointer<BlockFollower> guard(this);
+    const quint64 generation = m_generation;
+
+    // Rollback events are emitted from the top of the abandoned chain down to the fork point.
+    int rolledBack = 0;
+    while (!m_recentHashes.isEmpty() && m_recentHashes.lastKey() > forkBlockNumber) {
+        const qint32 blockNumber = m_recentHashes.lastKey();
+        const QString hash = m_recentHashes.take(blockNumber);
+        rolledBack++;
+
+        emit blockRolledBack(blockNumber,hash);
+        if (guard.isNull() || m_generation != generation)
+            return;
+    }
+
+    emit chainReorganized(forkBlockNumber,rolledBack);
+    if (guard.isNull() || m_generation != generation)
+        return;
+
+    // Then blocks of the new chain are applied in normal order.
+    const QList<Proxy::Block> chain = m_reorgChain;
+    m_reorgChain.clear();
+    qint32 lastApplied = forkBlockNumber;
+    for (const Proxy::Block& block : chain) {
+        rememberBlock(block);
+        lastApplied = block.number();
+
+        emit blockReceived(block);
+        if (guard.isNull() || m_generation != generation)
+            return;
+    }
+
+    resumeAfter(lastApplied);
+}
+
+void BlockFollower::resumeAfter(qint32 blockNumber)
+{
+    // Buffered blocks might belong to the abandoned chain.
+    m_ready.clear();
+    m_retry.clear();
+    m_nextToDeliver = blockNumber + 1;
+    m_nextToFetch = blockNumber + 1;
+
+    updateLag();
+    fetchMissing();
+}
+
+void BlockFollower::updateLag()
+{
+    const qint32 currentLag = lag();
+    if (currentLag == m_reportedLag)
+        return;
+
+    m_reportedLag = currentLag;
+    emit lagChanged(currentLag);
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,189 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_BLOCKFOLLOWER_H
+#define QT_ETHERSCAN_BLOCKFOLLOWER_H
+
+#include <QObject>
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMap>
+#include <QPointer>
+#include <QTimer>
+
+#include <functional>
+
+#include "./qethsc_requestcontext.h"
+#include "./types/proxy/eth_block.h"
+
+namespace QtEtherscan {
+
+class API;
+class PendingRequest;
+
+/*! @class BlockFollower src/qethsc_blockfollower.h
+ *  @brief Object of this class follows the head of the chain and delivers new blocks strictly in order.
+ *  @details Head block number is polled with API::eth_blockNumber. After new head appears next poll is made around the
+ *           moment when next block is expected (BlockFollower::blockTime, adjusted using timestamps of the received
+ *           blocks). If expected block is late - head is polled every BlockFollower::minimumPollInterval mseconds.
+ *           Missing blocks are fetched with API::eth_getBlockByNumber, up to BlockFollower::maxConcurrentFetches
+ *           requests at once, so after network outage follower catches up as fast as RequestScheduler allows.
+ *           Blocks are delivered by BlockFollower::blockReceived signal in the order of their numbers.
+ *
+ *           Hashes of the last BlockFollower::reorgWindow delivered blocks are remembered. If parentHash of the next
+ *           block does not match - blocks of the new chain are fetched going down, until the fork point is found.
+ *           After that BlockFollower::blockRolledBack is emitted for each abandoned block (from the top), followed by
+ *           BlockFollower::chainReorganized and BlockFollower::blockReceived for each block of the new chain.
+ *
+ *  @code
+ *  QtEtherscan::BlockFollower* follower = new QtEtherscan::BlockFollower(&etherscan,this);
+ *  connect(follower, &QtEtherscan::BlockFollower::blockReceived, this, &Monitor::onBlock);
+ *  follower->start();
+ *  @endcode */
+
+class BlockFollower : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BlockFollower(API* api, QObject* parent = nullptr);
+    ~BlockFollower();
+
+    /*! @brief Returns expected time (in mseconds) between blocks. Default value - 12000. */
+    quint32        blockTime() const                       { return m_blockTime; }
+
+    /*! @brief Sets expected time between blocks. This value is used until timestamps of the received blocks allow to
+     *         estimate real block time. */
+    void           setBlockTime(quint32 msec)              { m_blockTime = msec; m_estimatedBlockTime = msec; }
+
+    /*! @brief Returns currently estimated time (in mseconds) between blocks. */
+    quint32        estimatedBlockTime() const              { return static_cast<quint32>(m_estimatedBlockTime); }
+
+    /*! @brief Returns minimal interval (in mseconds) between head polls. Default value - 1000. */
+    quint32        minimumPollInterval() const             { return m_minimumPollInterval; }
+    void           setMinimumPollInterval(quint32 msec)    { m_minimumPollInterval = msec; }
+
+    /*! @brief Returns maximal amount of blocks fetched at once. Default value - 4. */
+    int            maxConcurrentFetches() const            { return m_maxConcurrentFetches; }
+    void           setMaxConcurrentFetches(int count)      { m_maxConcurrentFetches = qMax(1,count); }
+
+    /*! @brief Returns amount of the last delivered blocks, hashes of which are remembered to detect reorganizations.
+     *         Reorganizations deeper than this value roll back all remembered blocks. Default value - 64. */
+    int            reorgWindow() const                     { return m_reorgWindow; }
+    void           setReorgWindow(int blocks)              { m_reorgWindow = qMax(1,blocks); }
+
+    /*! @brief Returns true if delivered blocks contain full transaction objects (Proxy::Block::transactions).
+     *         Otherwise only transaction hashes are available. Default value - false. */
+    bool           fullTransactions() const                { return m_fullTransactions; }
+    void           setFullTransactions(bool enabled)       { m_fullTransactions = enabled; }
+
+    /*! @brief Returns true if this follower is started. */
+    bool           isRunning() const                       { return m_running; }
+
+    /*! @brief Returns last known head block number. */
+    qint32         headBlockNumber() const                 { return m_head; }
+
+    /*! @brief Returns number of the last delivered block. */
+    qint32         lastDeliveredBlockNumber() const        { return m_nextToDeliver - 1; }
+
+    /*! @brief Returns amount of blocks, which are already produced but not delivered yet. */
+    qint32         lag() const;
+
+public slots:
+    /*! @brief Starts following the chain.
+     *  @param fromBlock - number of the first block to be delivered. By default delivery starts from the current
+     *         head block. */
+    void           start(qint32 fromBlock = InvalidBlockNumber);
+
+    /*! @brief Stops following the chain. Requests in progress are aborted. */
+    void           stop();
+
+signals:
+    /*! @brief This signal is emitted for each block in the order of block numbers. */
+    void           blockReceived(const QtEtherscan::Proxy::Block& block);
+
+    /*! @brief This signal is emitted for each previously delivered block, which is not a part of the chain anymore.
+     *         Blocks are rolled back from the highest number down to the fork point. */
+    void           blockRolledBack(qint32 blockNumber, const QString& hash);
+
+    /*! @brief This signal is emitted after rolling back blocks above forkBlockNumber and before delivering blocks of
+     *         the new chain. */
+    void           chainReorganized(qint32 forkBlockNumber, int rolledBackCount);
+
+    /*! @brief This signal is emitted when new head block number is discovered. */
+    void           headChanged(qint32 blockNumber);
+
+    /*! @brief This signal is emitted when amount of not delivered blocks changes. */
+    void           lagChanged(qint32 lag);
+
+private:
+    void           pollHead();
+    void           onHead(const QJsonObject& response);
+    void           scheduleNextPoll();
+    void           fetchMissing();
+    void           requestBlock(qint32 blockNumber, const RequestContext& context,
+                                const std::function<void(const Proxy::Block&)>& callback);
+    void           fetchBlock(qint32 blockNumber);
+    void           onBlock(qint32 blockNumber, const Proxy::Block& block);
+    void           deliverReady();
+    void           rememberBlock(const Proxy::Block& block);
+    void           findForkPoint();
+    void           onForkCandidate(const Proxy::Block& block);
+    void           applyReorg(qint32 forkBlockNumber);
+    void           resumeAfter(qint32 blockNumber);
+    void           updateLag();
+    void           abortRequests();
+
+    QPointer<API>                m_api;
+
+    quint32                      m_blockTime;
+    double                       m_estimatedBlockTime;
+    quint32                      m_minimumPollInterval;
+    int                          m_maxConcurrentFetches;
+    int                          m_reorgWindow;
+    bool                         m_fullTransactions;
+
+    bool                         m_running;
+    quint64                      m_generation;
+    qint32                       m_head;
+    qint32                       m_nextToFetch;
+    qint32                       m_nextToDeliver;
+    qint32                       m_reportedLag;
+    qint64                       m_lastTimestamp;
+
+    QTimer                       m_pollTimer;
+    QTimer                       m_retryTimer;
+    QElapsedTimer                m_sinceHeadChange;
+    QPointer<PendingRequest>     m_headRequest;
+    QList<QPointer<PendingRequest>> m_blockRequests;
+    int                          m_inFlight;
+    QList<qint32>                m_retry;
+    QMap<qint32,Proxy::Block>    m_ready;
+    QMap<qint32,QString>         m_recentHashes;
+    QList<Proxy::Block>          m_reorgChain;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_BLOCKFOLLOWER_H
@@ -0,0 +1,253 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_blockrangefetcher.h"
+
+#include <QFile>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <utility>
+
+#include "qethsc_api.h"
+#include "qethsc_pendingrequest.h"
+
+namespace QtEtherscan {
+
+BlockRangeFetcher::BlockRangeFetcher(API* api, QObject* parent) :
+    QObject{parent},
+    m_api{api},
+    m_maxConcurrentFetches{8},
+    m_windowSize{64},
+    m_retryDelay{1000},
+    m_priority{RequestScheduler::Bulk},
+    m_fullTransactions{false},
+    m_backgroundDecoding{false},
+    m_checkpointInterval{100},
+    m_running{false},
+    m_paused{false},
+    m_generation{0},
+    m_toBlock{InvalidBlockNumber},
+    m_nextToFetch{InvalidBlockNumber},
+    m_nextToDeliver{InvalidBlockNumber},
+    m_sinceCheckpoint{0},
+    m_inFlight{0}
+{
+    m_retryTimer.setSingleShot(true);
+    connect(&m_retryTimer, &QTimer::timeout, this, &BlockRangeFetcher::fetchMore);
+}
+
+BlockRangeFetcher::~BlockRangeFetcher()
+{
+    stop();
+}
+
+void BlockRangeFetcher::start(qint32 fromBlock, qint32 toBlock)
+{
+    stop();
+
+    const qint32 checkpoint = loadCheckpoint();
+    if (checkpoint > fromBlock && checkpoint <= toBlock + 1)
+        fromBlock = checkpoint;
+
+    m_running = true;
+    m_paused = false;
+    m_toBlock = toBlock;
+    m_nextToFetch = fromBlock;
+    m_nextToDeliver = fromBlock;
+    m_sinceCheckpoint = 0;
+
+    if (fromBlock > toBlock) {
+        m_running = false;
+        emit finished();
+        return;
+    }
+
+    fetchMore();
+}
+
+void BlockRangeFetcher::stop()
+{
+    if (!m_running)
+        return;
+
+    m_running = false;
+    m_generation++;
+    m_retryTimer.stop();
+    abortRequests();
+    saveCheckpoint();
+
+    m_inFlight = 0;
+    m_retry.clear();
+    m_ready.clear();
+}
+
+void BlockRangeFetcher::pause()
+{
+    m_paused = true;
+}
+
+void BlockRangeFetcher::resume()
+{
+    if (!m_paused)
+        return;
+
+    m_paused = false;
+    deliverReady();
+    fetchMore();
+}
+
+void BlockRangeFetcher::abortRequests()
+{
+    // Callbacks of the aborted requests are ignored, as generation was changed.
+    for (const QPointer<PendingRequest>& request : std::as_const(m_requests)) {
+        if (!request.isNull())
+            request->abort();
+    }
+    m_requests.clear();
+}
+
+void BlockRangeFetcher::fetchMore()
+{
+    if (!m_running)
+        return;
+
+    // Blocks are not requested beyond the window, so slow or paused consumer limits the speed of fetching.
+    const qint32 fetchLimit = qMin(m_toBlock + 1,m_nextToDeliver + m_windowSize);
+
+    while (m_inFlight < m_maxConcurrentFetches) {
+        if (!m_retry.isEmpty() && !m_retryTimer.isActive()) {
+            fetchBlock(m_retry.takeFirst());
+            continue;
+        }
+
+        if (m_nextToFetch >= fetchLimit)
+            return;
+
+        fetchBlock(m_nextToFetch++);
+    }
+}
+
+void BlockRangeFetcher::fetchBlock(qint32 blockNumber)
+{
+    if (m_api.isNull())
+        return;
+
+    RequestContext context;
+    context.setPriority(m_priority);
+
+    m_inFlight++;
+
+    const quint64 generation = m_generation;
+    QPointer<BlockRangeFetcher> guard(this);
+    m_requests.removeAll(QPointer<PendingRequest>());
+    m_requests.append(m_api->asyncGetBlockByNumber(blockNumber,m_fullTransactions,context,
+                                                   [guard,generation,blockNumber](const Proxy::Block& block) {
+        if (guard.isNull() || guard->m_generation != generation)
+            return;
+
+        guard->onBlock(blockNumber,block);
+    },m_backgroundDecoding));
+}
+
+void BlockRangeFetcher::onBlock(qint32 blockNumber, const Proxy::Block& block)
+{
+    m_inFlight--;
+
+    if (!block.isValid()) {
+        m_retry.append(blockNumber);
+        std::sort(m_retry.begin(),m_retry.end());
+        if (!m_retryTimer.isActive())
+            m_retryTimer.start(static_cast<int>(m_retryDelay));
+    } else {
+        m_ready.insert(blockNumber,block);
+        deliverReady();
+    }
+
+    fetchMore();
+}
+
+void BlockRangeFetcher::deliverReady()
+{
+    QPointer<BlockRangeFetcher> guard(this);
+    const quint64 generation = m_generation;
+
+    while (m_running && !m_paused && !m_ready.isEmpty() && m_ready.firstKey() == m_nextToDeliver) {
+        const Proxy::Block block = m_ready.take(m_nextToDeliver);
+        m_nextToDeliver++;
+
+        emit blockReceived(block);
+
+        // Receiver might have stopped, restarted or deleted this fetcher.
+        if (guard.isNull() || m_generation != generation)
+            return;
+
+        if (++m_sinceCheckpoint >= m_checkpointInterval) {
+            m_sinceCheckpoint = 0;
+            saveCheckpoint();
+            emit checkpointReached(m_nextToDeliver);
+
+            if (guard.isNull() || m_generation != generation)
+                return;
+        }
+    }
+
+    if (m_running && m_nextToDeliver > m_toBlock) {
+        m_running = false;
+        m_generation++;
+        m_retryTimer.stop();
+        saveCheckpoint();
+        emit finished();
+    }
+}
+
+void BlockRangeFetcher::saveCheckpoint()
+{
+    if (m_checkpointFile.isEmpty() || m_nextToDeliver == InvalidBlockNumber)
+        return;
+
+    // QSaveFile replaces the file atomically, so crash during writing does not destroy previous checkpoint.
+    QSaveFile file(m_checkpointFile);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return;
+
+    file.write(QByteArray::number(m_nextToDeliver));
+    file.commit();
+}
+
+qint32 BlockRangeFetcher::loadCheckpoint() const
+{
+    if (m_checkpointFile.isEmpty())
+        return InvalidBlockNumber;
+
+    QFile file(m_checkpointFile);
+    if (!file.open(QIODevice::ReadOnly))
+        return InvalidBlockNumber;
+
+    bool ok = false;
+    const qint32 checkpoint = file.readAll().trimmed().toInt(&ok);
+    return ok ? checkpoint : InvalidBlockNumber;
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,182 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_BLOCKRANGEFETCHER_H
+#define QT_ETHERSCAN_BLOCKRANGEFETCHER_H
+
+#include <QObject>
+
+#include <QList>
+#include <QMap>
+#include <QPointer>
+#include <QTimer>
+
+#include "./qethsc_requestscheduler.h"
+#include "./types/proxy/eth_block.h"
+
+namespace QtEtherscan {
+
+class API;
+class PendingRequest;
+
+/*! @class BlockRangeFetcher src/qethsc_blockrangefetcher.h
+ *  @brief Object of this class fetches range of blocks (e.g. for backfilling indexes) and delivers them in ascending
+ *         order.
+ *  @details Up to BlockRangeFetcher::maxConcurrentFetches requests to API::eth_getBlockByNumber are kept in flight,
+ *           so speed of fetching is limited by RequestScheduler of the API object and not by the latency of the
+ *           etherscan.io servers. Blocks received out of order are kept in the window of BlockRangeFetcher::windowSize
+ *           blocks. If the first not delivered block is late or fetcher is paused (BlockRangeFetcher::pause) - no
+ *           blocks beyond this window are requested. Failed blocks are requested again after
+ *           BlockRangeFetcher::retryDelay.
+ *
+ *           If BlockRangeFetcher::setBackgroundDecoding is enabled - replies are parsed by the threads of global
+ *           QThreadPool, while next blocks are downloaded. Block, which is being decoded, still counts as fetch in
+ *           progress, so at most BlockRangeFetcher::maxConcurrentFetches replies wait for decoding.
+ *
+ *           Number of the first not delivered block is a checkpoint. It is reported by
+ *           BlockRangeFetcher::checkpointReached signal and, if BlockRangeFetcher::setCheckpointFile was called, saved
+ *           to the file. When started again with the same checkpoint file fetcher continues from the saved block.
+ *
+ *  @code
+ *  QtEtherscan::BlockRangeFetcher* fetcher = new QtEtherscan::BlockRangeFetcher(&etherscan,this);
+ *  fetcher->setCheckpointFile("backfill.checkpoint");
+ *  connect(fetcher, &QtEtherscan::BlockRangeFetcher::blockReceived, this, &Indexer::indexBlock);
+ *  connect(fetcher, &QtEtherscan::BlockRangeFetcher::finished, this, &Indexer::backfillFinished);
+ *  fetcher->start(17000000,17100000);
+ *  @endcode */
+
+class BlockRangeFetcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BlockRangeFetcher(API* api, QObject* parent = nullptr);
+    ~BlockRangeFetcher();
+
+    /*! @brief Returns maximal amount of blocks requested at once. Default value - 8. */
+    int            maxConcurrentFetches() const            { return m_maxConcurrentFetches; }
+    void           setMaxConcurrentFetches(int count)      { m_maxConcurrentFetches = qMax(1,count); }
+
+    /*! @brief Returns maximal amount of blocks, which can be fetched ahead of the first not delivered block. Default
+     *         value - 64. */
+    int            windowSize() const                      { return m_windowSize; }
+    void           setWindowSize(int blocks)               { m_windowSize = qMax(1,blocks); }
+
+    /*! @brief Returns delay (in mseconds) before failed block is requested again. Default value - 1000. */
+    quint32        retryDelay() const                      { return m_retryDelay; }
+    void           setRetryDelay(quint32 msec)             { m_retryDelay = msec; }
+
+    /*! @brief Returns priority of the requests made by this fetcher. Default value - RequestScheduler::Bulk. */
+    RequestScheduler::Priority priority() const            { return m_priority; }
+    void           setPriority(RequestScheduler::Priority priority) { m_priority = priority; }
+
+    /*! @brief Returns true if delivered blocks contain full transaction objects. Default value - false. */
+    bool           fullTransactions() const                { return m_fullTransactions; }
+    void           setFullTransactions(bool enabled)       { m_fullTransactions = enabled; }
+
+    /*! @brief Returns true if replies are decoded by the threads of global QThreadPool. Blocks are delivered in the
+     *         thread of this fetcher anyway. Default value - false. */
+    bool           backgroundDecoding() const              { return m_backgroundDecoding; }
+    void           setBackgroundDecoding(bool enabled)     { m_backgroundDecoding = enabled; }
+
+    /*! @brief Returns path to the file, where checkpoint is saved. By default checkpoint is not saved. */
+    QString        checkpointFile() const                  { return m_checkpointFile; }
+    void           setCheckpointFile(const QString& path)  { m_checkpointFile = path; }
+
+    /*! @brief Returns amount of delivered blocks between checkpoints. Default value - 100. */
+    int            checkpointInterval() const              { return m_checkpointInterval; }
+    void           setCheckpointInterval(int blocks)       { m_checkpointInterval = qMax(1,blocks); }
+
+    /*! @brief Returns number of the first not delivered block. All blocks below it were already delivered. */
+    qint32         checkpoint() const                      { return m_nextToDeliver; }
+
+    /*! @brief Returns true if fetcher is started and not all blocks were delivered yet. */
+    bool           isRunning() const                       { return m_running; }
+
+    /*! @brief Returns true if fetcher is paused. */
+    bool           isPaused() const                        { return m_paused; }
+
+public slots:
+    /*! @brief Starts fetching blocks from fromBlock to toBlock (inclusive). If checkpoint file contains number of the
+     *         block within this range - fetching continues from it. */
+    void           start(qint32 fromBlock, qint32 toBlock);
+
+    /*! @brief Stops fetching. Requests in progress are aborted. Checkpoint is saved. */
+    void           stop();
+
+    /*! @brief Stops delivering blocks. Requests in progress are completed, but no new requests beyond the window are
+     *         made. Can be used by slow consumers to apply backpressure. */
+    void           pause();
+
+    /*! @brief Continues delivering blocks after BlockRangeFetcher::pause. */
+    void           resume();
+
+signals:
+    /*! @brief This signal is emitted for each block in ascending order of block numbers. */
+    void           blockReceived(const QtEtherscan::Proxy::Block& block);
+
+    /*! @brief This signal is emitted each BlockRangeFetcher::checkpointInterval delivered blocks.
+     *  @param nextBlock - number of the first not delivered block. */
+    void           checkpointReached(qint32 nextBlock);
+
+    /*! @brief This signal is emitted after delivering the last block of the range. */
+    void           finished();
+
+private:
+    void           fetchMore();
+    void           fetchBlock(qint32 blockNumber);
+    void           onBlock(qint32 blockNumber, const Proxy::Block& block);
+    void           deliverReady();
+    void           saveCheckpoint();
+    qint32         loadCheckpoint() const;
+    void           abortRequests();
+
+    QPointer<API>                m_api;
+
+    int                          m_maxConcurrentFetches;
+    int                          m_windowSize;
+    quint32                      m_retryDelay;
+    RequestScheduler::Priority   m_priority;
+    bool                         m_fullTransactions;
+    bool                         m_backgroundDecoding;
+    QString                      m_checkpointFile;
+    int                          m_checkpointInterval;
+
+    bool                         m_running;
+    bool                         m_paused;
+    quint64                      m_generation;
+    qint32                       m_toBlock;
+    qint32                       m_nextToFetch;
+    qint32                       m_nextToDeliver;
+    int                          m_sinceCheckpoint;
+
+    int                          m_inFlight;
+    QList<qint32>                m_retry;
+    QTimer                       m_retryTimer;
+    QMap<qint32,Proxy::Block>    m_ready;
+    QList<QPointer<PendingRequest>> m_requests;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_BLOCKRANGEFETCHER_H
@@ -0,0 +1,228 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_blockreceiptsfetcher.h"
+
+#include <QTimer>
+
+#include <utility>
+
+#include "qethsc_api.h"
+#include "qethsc_pendingrequest.h"
+
+namespace QtEtherscan {
+
+BlockReceiptsFetcher::BlockReceiptsFetcher(API* api, QObject* parent) :
+    QObject{parent},
+    m_api{api},
+    m_maxConcurrentRequests{16},
+    m_maxAttempts{5},
+    m_retryDelay{1000},
+    m_priority{RequestScheduler::Normal},
+    m_generation{0},
+    m_nextJobId{0},
+    m_inFlight{0}
+{}
+
+BlockReceiptsFetcher::~BlockReceiptsFetcher()
+{
+    clear();
+}
+
+void BlockReceiptsFetcher::fetch(const Proxy::Block& block)
+{
+    const quint64 jobId = m_nextJobId++;
+
+    Job& job = m_jobs[jobId];
+    job.block = block;
+    job.hashes = block.transactionHashList();
+    job.receipts.resize(job.hashes.size());
+    job.attempts.fill(0,job.hashes.size());
+    job.remaining = job.hashes.size();
+
+    if (job.remaining == 0) {
+        deliverReady();
+        return;
+    }
+
+    if (m_bulkUrl.isValid())
+        fetchBulk(jobId);
+    else
+        enqueueAll(jobId);
+}
+
+void BlockReceiptsFetcher::clear()
+{
+    // Callbacks of the aborted requests are ignored, as generation was changed.
+    m_generation++;
+
+    for (const QPointer<PendingRequest>& request : std::as_const(m_requests)) {
+        if (!request.isNull())
+            request->abort();
+    }
+    m_requests.clear();
+
+    m_jobs.clear();
+    m_tasks.clear();
+    m_inFlight = 0;
+}
+
+void BlockReceiptsFetcher::fetchBulk(quint64 jobId)
+{
+    if (m_api.isNull())
+        return;
+
+    RequestContext context;
+    context.setPriority(m_priority);
+
+    const quint64 generation = m_generation;
+    QPointer<BlockReceiptsFetcher> guard(this);
+    m_requests.removeAll(QPointer<PendingRequest>());
+    m_requests.append(m_api->asyncGetBlockReceipts(m_bulkUrl,m_jobs.value(jobId).block.numberString(),context,
+                                                   [guard,generation,jobId](const Proxy::TransactionReceiptList& receipts) {
+        if (guard.isNull() || guard->m_generation != generation)
+            return;
+
+        guard->onBulkReply(jobId,receipts);
+    }));
+}
+
+void BlockReceiptsFetcher::onBulkReply(quint64 jobId, const Proxy::TransactionReceiptList& receipts)
+{
+    auto job = m_jobs.find(jobId);
+    if (job == m_jobs.end())
+        return;
+
+    // Receipts are accepted only if there is one for each transaction, in the same order.
+    bool complete = (receipts.size() == job->hashes.size());
+    for (int i = 0; complete && i < receipts.size(); i++)
+        complete = (receipts.at(i).transactionHash() == job->hashes.at(i));
+
+    if (!complete) {
+        enqueueAll(jobId);
+        return;
+    }
+
+    for (int i = 0; i < receipts.size(); i++)
+        job->receipts[i] = receipts.at(i);
+    job->remaining = 0;
+
+    deliverReady();
+}
+
+void BlockReceiptsFetcher::enqueueAll(quint64 jobId)
+{
+    const int count = m_jobs.value(jobId).hashes.size();
+    for (int i = 0; i < count; i++)
+        m_tasks.append({ jobId, i });
+
+    startTasks();
+}
+
+void BlockReceiptsFetcher::startTasks()
+{
+    if (m_api.isNull())
+        return;
+
+    RequestContext context;
+    context.setPriority(m_priority);
+
+    while (m_inFlight < m_maxConcurrentRequests && !m_tasks.isEmpty()) {
+        const Task task = m_tasks.takeFirst();
+
+        auto job = m_jobs.find(task.job);
+        if (job == m_jobs.end() || job->failed)
+            continue;
+
+        job->attempts[task.index]++;
+        m_inFlight++;
+
+        const quint64 generation = m_generation;
+        QPointer<BlockReceiptsFetcher> guard(this);
+        m_requests.removeAll(QPointer<PendingRequest>());
+        m_requests.append(m_api->asyncGetTransactionReceipt(job->hashes.at(task.index),context,
+                                                            [guard,generation,task](const Proxy::TransactionReceipt& receipt) {
+            if (guard.isNull() || guard->m_generation != generation)
+                return;
+
+            guard->onReceipt(task,receipt);
+        }));
+    }
+}
+
+void BlockReceiptsFetcher::onReceipt(const Task& task, const Proxy::TransactionReceipt& receipt)
+{
+    m_inFlight--;
+
+    auto job = m_jobs.find(task.job);
+    if (job != m_jobs.end() && !job->failed) {
+        if (receipt.isValid()) {
+            job->receipts[task.index] = receipt;
+            job->remaining--;
+        } else if (job->attempts.at(task.index) < m_maxAttempts) {
+            // Receipt might be not indexed yet, requesting it again a bit later.
+            const quint64 generation = m_generation;
+            QTimer::singleShot(static_cast<int>(m_retryDelay), this, [this,generation,task]() {
+                if (m_generation != generation)
+                    return;
+
+                m_tasks.append(task);
+                startTasks();
+            });
+        } else {
+            job->failed = true;
+        }
+    }
+
+    deliverReady();
+    startTasks();
+}
+
+void BlockReceiptsFetcher::deliverReady()
+{
+    QPointer<BlockReceiptsFetcher> guard(this);
+    const quint64 generation = m_generation;
+
+    // Blocks are delivered in the same order in which they were passed to fetch()
+    while (!m_jobs.isEmpty() && (m_jobs.first().remaining == 0 || m_jobs.first().failed)) {
+        const Job job = m_jobs.take(m_jobs.firstKey());
+
+        if (job.failed) {
+            emit fetchFailed(job.block);
+        } else {
+            Proxy::TransactionReceiptList receipts;
+            receipts.reserve(job.receipts.size());
+            for (const Proxy::TransactionReceipt& receipt : job.receipts)
+                receipts.append(receipt);
+
+            emit blockReceiptsReceived(Proxy::BlockReceipts(job.block,receipts));
+        }
+
+        // Receiver might have cleared or deleted this fetcher.
+        if (guard.isNull() || m_generation != generation)
+            return;
+    }
+}
+
+} //namespace QtEtherscan
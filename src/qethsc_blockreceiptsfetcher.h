@@ -0,0 +1,153 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_BLOCKRECEIPTSFETCHER_H
+#define QT_ETHERSCAN_BLOCKRECEIPTSFETCHER_H
+
+#include <QObject>
+
+#include <QList>
+#include <QMap>
+#include <QPointer>
+#include <QUrl>
+#include <QVector>
+
+#include "./qethsc_requestscheduler.h"
+#include "./types/proxy/eth_blockreceipts.h"
+
+namespace QtEtherscan {
+
+class API;
+class PendingRequest;
+
+/*! @class BlockReceiptsFetcher src/qethsc_blockreceiptsfetcher.h
+ *  @brief Object of this class fetches receipts of all transactions of the blocks.
+ *  @details Blocks are passed to BlockReceiptsFetcher::fetch (e.g. directly from BlockFollower::blockReceived or
+ *           BlockRangeFetcher::blockReceived). For each transaction from Proxy::Block::transactionHashList receipt is
+ *           requested with API::eth_getTransactionReceipt. Up to BlockReceiptsFetcher::maxConcurrentRequests requests
+ *           are kept in flight, so speed is limited by RequestScheduler of the API object. Blocks with all receipts
+ *           are delivered by BlockReceiptsFetcher::blockReceiptsReceived signal in the same order in which they were
+ *           passed to BlockReceiptsFetcher::fetch.
+ *
+ *           If node supporting eth_getBlockReceipts JSON-RPC method is available, its URL can be set with
+ *           BlockReceiptsFetcher::setBulkReceiptsUrl. In this case all receipts of the block are requested from
+ *           this node with single request. Such requests are sent by API object like other JSON-RPC requests (see
+ *           API::setJsonRpcUrl), so its proxy, request timeout and maximal reply size are respected. If such request
+ *           fails - receipts of this block are requested from etherscan.io one by one.
+ *
+ *  @code
+ *  QtEtherscan::BlockReceiptsFetcher* receipts = new QtEtherscan::BlockReceiptsFetcher(&etherscan,this);
+ *  connect(follower, &QtEtherscan::BlockFollower::blockReceived, receipts, &QtEtherscan::BlockReceiptsFetcher::fetch);
+ *  connect(receipts, &QtEtherscan::BlockReceiptsFetcher::blockReceiptsReceived, this, &Indexer::processBlock);
+ *  @endcode */
+
+class BlockReceiptsFetcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BlockReceiptsFetcher(API* api, QObject* parent = nullptr);
+    ~BlockReceiptsFetcher();
+
+    /*! @brief Returns maximal amount of receipt requests kept in flight. Default value - 16. */
+    int            maxConcurrentRequests() const           { return m_maxConcurrentRequests; }
+    void           setMaxConcurrentRequests(int count)     { m_maxConcurrentRequests = qMax(1,count); }
+
+    /*! @brief Returns amount of attempts made to get single receipt before giving up the whole block. Default value
+     *         - 5. */
+    int            maxAttempts() const                     { return m_maxAttempts; }
+    void           setMaxAttempts(int attempts)            { m_maxAttempts = qMax(1,attempts); }
+
+    /*! @brief Returns delay (in mseconds) before failed receipt is requested again. Default value - 1000. */
+    quint32        retryDelay() const                      { return m_retryDelay; }
+    void           setRetryDelay(quint32 msec)             { m_retryDelay = msec; }
+
+    /*! @brief Returns priority of the requests to etherscan.io made by this fetcher. Default value -
+     *         RequestScheduler::Normal. */
+    RequestScheduler::Priority priority() const            { return m_priority; }
+    void           setPriority(RequestScheduler::Priority priority) { m_priority = priority; }
+
+    /*! @brief Returns URL of the JSON-RPC node supporting eth_getBlockReceipts method. By default URL is empty and
+     *         receipts are requested from etherscan.io one by one. */
+    QUrl           bulkReceiptsUrl() const                 { return m_bulkUrl; }
+    void           setBulkReceiptsUrl(const QUrl& url)     { m_bulkUrl = url; }
+
+    /*! @brief Returns amount of blocks passed to BlockReceiptsFetcher::fetch, which are not delivered yet. */
+    int            pendingBlocks() const                   { return m_jobs.size(); }
+
+public slots:
+    /*! @brief Starts fetching receipts for the block. */
+    void           fetch(const QtEtherscan::Proxy::Block& block);
+
+    /*! @brief Drops all blocks which are not delivered yet. Requests in progress are aborted. */
+    void           clear();
+
+signals:
+    /*! @brief This signal is emitted when receipts of all transactions of the block are received. */
+    void           blockReceiptsReceived(const QtEtherscan::Proxy::BlockReceipts& blockReceipts);
+
+    /*! @brief This signal is emitted instead of BlockReceiptsFetcher::blockReceiptsReceived if receipt of at least one
+     *         transaction of the block was not received after BlockReceiptsFetcher::maxAttempts attempts. */
+    void           fetchFailed(const QtEtherscan::Proxy::Block& block);
+
+private:
+    struct Job {
+        Proxy::Block                       block;
+        QStringList                        hashes;
+        QVector<Proxy::TransactionReceipt> receipts;
+        QVector<int>                       attempts;
+        int                                remaining = 0;
+        bool                               failed = false;
+    };
+
+    struct Task {
+        quint64  job;
+        int      index;
+    };
+
+    void           fetchBulk(quint64 jobId);
+    void           onBulkReply(quint64 jobId, const Proxy::TransactionReceiptList& receipts);
+    void           enqueueAll(quint64 jobId);
+    void           startTasks();
+    void           onReceipt(const Task& task, const Proxy::TransactionReceipt& receipt);
+    void           deliverReady();
+
+    QPointer<API>                m_api;
+
+    int                          m_maxConcurrentRequests;
+    int                          m_maxAttempts;
+    quint32                      m_retryDelay;
+    RequestScheduler::Priority   m_priority;
+    QUrl                         m_bulkUrl;
+
+    quint64                      m_generation;
+    quint64                      m_nextJobId;
+    QMap<quint64,Job>            m_jobs;
+    QList<Task>                  m_tasks;
+    int                          m_inFlight;
+    QList<QPointer<PendingRequest>> m_requests;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_BLOCKRECEIPTSFETCHER_H
@@ -0,0 +1,143 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_CACHEPOLICY_H
+#define QT_ETHERSCAN_CACHEPOLICY_H
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QUrlQuery>
+
+#include "./qethsc_endpoints.h"
+#include "./qethsc_querytemplate.h"
+
+namespace QtEtherscan {
+
+/*! @class CachePolicy src/qethsc_cachepolicy.h
+ *  @brief This class describes replies to which API actions are cached and for how long.
+ *  @details Each cached action has two TTL values. While cached reply is younger than soft TTL - it is returned
+ *           without making any request. When cached reply is older than soft TTL, but younger than hard TTL - it is
+ *           still returned immediately, but one background request is made to refresh it (stale-while-revalidate).
+ *           When cached reply is older than hard TTL - caller waits for the fresh reply. Only successful replies are
+ *           cached. Default-constructed policy caches nothing, API objects use CachePolicy::endpointDefaults. TTL can
+ *           be set either for the action or for the single endpoint (see QtEtherscan::Endpoints). Settings of the
+ *           endpoint take precedence over settings of its action.
+ *
+ *  @code
+ *  etherscan.setCachePolicy(QtEtherscan::CachePolicy::latestData());
+ *  @endcode */
+
+class CachePolicy
+{
+public:
+    /*! @brief Constructs CachePolicy object with caching disabled for all actions. */
+    CachePolicy() {}
+
+    /*! @brief Returns CachePolicy with stale-while-revalidate caching enabled for endpoints marked with
+     *         Endpoints::LatestData flag (API::getGasOracle, API::getEtherLastPrice, API::eth_gasPrice,
+     *         API::eth_blockNumber and others).
+     *  @param softTtl - age (in mseconds) after which cached reply is refreshed in background.
+     *  @param hardTtl - age (in mseconds) after which cached reply is not used anymore. */
+    static CachePolicy latestData(quint32 softTtl = 1000, quint32 hardTtl = 15000) {
+        CachePolicy policy;
+        Endpoints::forEach([&policy,softTtl,hardTtl](auto endpoint) {
+            typedef decltype(endpoint) Endpoint;
+            if constexpr (Endpoint::isLatestData)
+                policy.setTtl<Endpoint>(softTtl,hardTtl);
+        });
+        return policy;
+    }
+
+    /*! @brief Returns CachePolicy described by flags of the endpoints: endpoints marked with Endpoints::LatestData are
+     *         cached as by CachePolicy::latestData, replies of Endpoints::Immutable endpoints are kept for
+     *         immutableTtl without refreshing. This policy is used by API objects by default.
+     *  @param immutableTtl - age (in mseconds) after which cached reply of immutable endpoint is requested again. */
+    static CachePolicy endpointDefaults(quint32 softTtl = 1000, quint32 hardTtl = 15000, quint32 immutableTtl = 3600000) {
+        CachePolicy policy = latestData(softTtl,hardTtl);
+        Endpoints::forEach([&policy,immutableTtl](auto endpoint) {
+            typedef decltype(endpoint) Endpoint;
+            if constexpr (Endpoint::isImmutable)
+                policy.setTtl<Endpoint>(immutableTtl,immutableTtl);
+        });
+        return policy;
+    }
+
+    /*! @brief Returns true if caching is enabled for at least one action. */
+    bool           isEnabled() const                       { return !m_ttls.isEmpty(); }
+
+    /*! @brief Returns true if replies for the specified action (e.g. "gasoracle") are cached. */
+    bool           isCached(const QString& action) const   { return m_ttls.contains(action); }
+
+    /*! @brief Enables caching of the replies for the specified action. If softTtl equals to hardTtl - replies are
+     *         never returned stale. */
+    void           setTtl(const QString& action, quint32 softTtl, quint32 hardTtl) {
+        m_ttls.insert(action,qMakePair(qMin(softTtl,hardTtl),hardTtl));
+    }
+
+    /*! @brief Enables caching of the replies for the endpoint described by E (see QtEtherscan::Endpoints). Other
+     *         endpoints with the same action (e.g. Endpoints::GetLogs and Endpoints::GetLogsByTopics) are not
+     *         affected. */
+    template<class E>
+    void           setTtl(quint32 softTtl, quint32 hardTtl) { setTtl(QueryTemplate::endpointKey<E>(),softTtl,hardTtl); }
+
+    /*! @brief Disables caching of the replies for the specified action. */
+    void           remove(const QString& action)           { m_ttls.remove(action); }
+
+    /*! @brief Disables caching of the replies for the endpoint described by E. */
+    template<class E>
+    void           remove()                                { m_ttls.remove(QueryTemplate::endpointKey<E>()); }
+
+    /*! @brief Returns list of actions and endpoint keys (see QueryTemplate::endpointKey), replies for which are
+     *         cached. */
+    QStringList    actions() const                         { return m_ttls.keys(); }
+
+    /*! @brief Returns true if replies for the query are cached. */
+    bool           isCached(const QUrlQuery& query) const  { return !m_ttls.isEmpty() && m_ttls.contains(settingsKey(query)); }
+
+    /*! @brief Returns soft TTL (in mseconds) for the query. */
+    quint32        softTtl(const QUrlQuery& query) const   { return m_ttls.value(settingsKey(query)).first; }
+
+    /*! @brief Returns hard TTL (in mseconds) for the query. */
+    quint32        hardTtl(const QUrlQuery& query) const   { return m_ttls.value(settingsKey(query)).second; }
+
+    /*! @brief Returns soft TTL (in mseconds) for the specified action. */
+    quint32        softTtl(const QString& action) const    { return m_ttls.value(action).first; }
+
+    /*! @brief Returns hard TTL (in mseconds) for the specified action. */
+    quint32        hardTtl(const QString& action) const    { return m_ttls.value(action).second; }
+
+private:
+    QString        settingsKey(const QUrlQuery& query) const {
+        const QString endpoint = QueryTemplate::endpointKey(query);
+        return m_ttls.contains(endpoint) ? endpoint : query.queryItemValue(QLatin1String("action"));
+    }
+
+    QHash<QString,QPair<quint32,quint32>> m_ttls;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_CACHEPOLICY_H
@@ -0,0 +1,68 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_CANCELLATIONTOKEN_H
+#define QT_ETHERSCAN_CANCELLATIONTOKEN_H
+
+#include <QObject>
+#include <QAtomicInt>
+
+namespace QtEtherscan {
+
+/*! @class CancellationToken src/qethsc_cancellationtoken.h
+ *  @brief Object of this class can be used to cancel requests to etherscan.io which are currently in progress.
+ *  @details Pass pointer to CancellationToken object to the RequestScope constructor. After calling
+ *           CancellationToken::cancel all requests made within this scope will be aborted as soon as possible and
+ *           API::errorCode will return API::CancelledError. Method CancellationToken::cancel can be safely called
+ *           from any thread. Once cancelled, token remains cancelled until CancellationToken::reset is called. */
+
+class CancellationToken : public QObject
+{
+    Q_OBJECT
+public:
+    explicit CancellationToken(QObject* parent = nullptr) :
+        QObject{parent}, m_cancelled{0} {}
+    ~CancellationToken() {}
+
+    /*! @brief Returns true if CancellationToken::cancel was called for this token. */
+    bool           isCancelled() const                     { return m_cancelled.loadAcquire() != 0; }
+
+    /*! @brief Returns this token to the initial (not cancelled) state. */
+    void           reset()                                 { m_cancelled.storeRelease(0); }
+
+public slots:
+    /*! @brief Cancels all requests associated with this token. */
+    void           cancel();
+
+signals:
+    /*! @brief This signal is emitted once, when this token is cancelled. */
+    void           cancelled();
+
+private:
+    QAtomicInt     m_cancelled;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_CANCELLATIONTOKEN_H
@@ -0,0 +1,245 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_COROUTINES_H
+#define QT_ETHERSCAN_COROUTINES_H
+
+/*! @file src/qethsc_coroutines.h
+ *  @brief Optional C++20 coroutine interface of QtEtherscan. Available only when compiler supports coroutines, so
+ *         project using it has to set CONFIG += c++20 (QtEtherscan.pri itself requires only c++17). */
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <QPointer>
+
+#include "./qethsc_api.h"
+
+namespace QtEtherscan {
+
+/*! @class AsyncReply src/qethsc_coroutines.h
+ *  @brief Object of this class is the result of co_await on EndpointAwaitable. It holds result of the call together
+ *         with its own error code, so several calls can be awaited at the same time. */
+
+template<class R>
+struct AsyncReply
+{
+    R              result;
+    API::Error     error = API::NoError;
+    QString        errorMessage;
+
+    /*! @brief Returns true if call has finished without errors. */
+    bool           isSuccessful() const                    { return error == API::NoError; }
+};
+
+/*! @class EndpointAwaitable src/qethsc_coroutines.h
+ *  @brief Object of this class is returned by QtEtherscan::async function. When it is co_await-ed - request to the
+ *         endpoint E (see QtEtherscan::Endpoints) is sent asynchronously, coroutine is suspended and resumed from the
+ *         Qt event loop when reply is received. Result of co_await is AsyncReply with the same value, which would be
+ *         returned by API::fetch.
+ *  @details Request is sent with RequestContext of the RequestScope active when QtEtherscan::async was called.
+ *           Replies of the cached actions (API::setCachePolicy) are taken from the cache in the same way as by
+ *           blocking calls. API::errorCode of the API object is not changed by asynchronous calls, but their replies
+ *           are reported to RequestScheduler in the same way as replies of blocking calls. */
+
+template<class E>
+class EndpointAwaitable
+{
+public:
+    typedef AsyncReply<typename E::Result> Reply;
+
+    template<class... Args>
+    EndpointAwaitable(API* api, const Args&... values)
+        : m_api{api},m_query{api->endpointQuery<E>(values...)},m_context{api->m_context},
+          m_inSuspend{false},m_completed{false} {}
+
+    bool           await_ready() const noexcept            { return false; }
+
+    bool           await_suspend(std::coroutine_handle<> handle) {
+        QPointer<API> api(m_api);
+        m_inSuspend = true;
+        m_api->makeAsyncCachedApiCall(m_query,m_context,
+            [this,api,handle](const QJsonObject& response, auto status) {
+                if (api)
+                    m_reply.result = api->template decodeAsyncResponse<E>(response,status,m_context,
+                                                                          &m_reply.error,&m_reply.errorMessage);
+
+                // Reply may be reported before await_suspend returns (e.g. cached reply or cancelled token)
+                if (m_inSuspend) {
+                    m_completed = true;
+                    return;
+                }
+                handle.resume();
+            });
+        m_inSuspend = false;
+
+        return !m_completed;
+    }
+
+    Reply          await_resume()                          { return std::move(m_reply); }
+
+private:
+    API*                         m_api;
+    QUrlQuery                    m_query;
+    RequestContext               m_context;
+    Reply                        m_reply;
+    bool                         m_inSuspend;
+    bool                         m_completed;
+};
+
+/*! @brief Returns awaitable object for the request to the endpoint E with parameters values (same as for API::fetch).
+ *
+ *  @code
+ *  QtEtherscan::Task<void> printGasPrice(QtEtherscan::API& api)
+ *  {
+ *      auto oracle = co_await QtEtherscan::async<QtEtherscan::Endpoints::GasOracle>(api);
+ *      if (oracle.isSuccessful())
+ *          qDebug() << oracle.result;
+ *  }
+ *  @endcode */
+
+template<class E, class... Args>
+EndpointAwaitable<E> async(API& api, const Args&... values) { return EndpointAwaitable<E>(&api,values...); }
+
+template<class T> class Task;
+
+namespace Private {
+
+template<class T>
+class TaskPromiseBase
+{
+public:
+    struct FinalAwaiter {
+        bool                     await_ready() const noexcept { return false; }
+        template<class P>
+        std::coroutine_handle<>  await_suspend(std::coroutine_handle<P> handle) noexcept {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.m_continuation)
+                return promise.m_continuation;
+            if (promise.m_detached)
+                handle.destroy();
+            return std::noop_coroutine();
+        }
+        void                     await_resume() const noexcept {}
+    };
+
+    std::suspend_never       initial_suspend() const noexcept   { return {}; }
+    FinalAwaiter             final_suspend() const noexcept     { return {}; }
+    void                     unhandled_exception() const noexcept { std::terminate(); }
+
+    std::coroutine_handle<>  m_continuation;
+    bool                     m_detached = false;
+};
+
+template<class T>
+class TaskPromise : public TaskPromiseBase<T>
+{
+public:
+    Task<T>                  get_return_object();
+    template<class U>
+    void                     return_value(U&& value)             { m_value.emplace(std::forward<U>(value)); }
+
+    std::optional<T>         m_value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase<void>
+{
+public:
+    Task<void>               get_return_object();
+    void                     return_void() const noexcept {}
+};
+
+} // namespace Private
+
+/*! @class Task src/qethsc_coroutines.h
+ *  @brief Minimal coroutine type, which can be used with QtEtherscan::async. Coroutine starts immediately and runs
+ *         until first suspension. Task can be co_await-ed from another coroutine or just dropped - in this case
+ *         coroutine keeps running and is destroyed when finished. Exceptions thrown from coroutine call
+ *         std::terminate. */
+
+template<class T = void>
+class Task
+{
+public:
+    typedef Private::TaskPromise<T> promise_type;
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept : m_handle{std::exchange(other.m_handle,nullptr)} {}
+    ~Task() {
+        if (!m_handle)
+            return;
+
+        if (m_handle.done())
+            m_handle.destroy();
+        else
+            m_handle.promise().m_detached = true;
+    }
+
+    /*! @brief Returns true if coroutine has finished. */
+    bool           isFinished() const                      { return !m_handle || m_handle.done(); }
+
+    bool           await_ready() const noexcept            { return m_handle.done(); }
+    void           await_suspend(std::coroutine_handle<> continuation) noexcept {
+        m_handle.promise().m_continuation = continuation;
+    }
+    T              await_resume() {
+        if constexpr (!std::is_void_v<T>)
+            return std::move(*m_handle.promise().m_value);
+    }
+
+private:
+    friend class Private::TaskPromise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle{handle} {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace Private {
+
+template<class T>
+Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace Private
+
+} // namespace QtEtherscan
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#endif // QT_ETHERSCAN_COROUTINES_H
@@ -0,0 +1,642 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_ENDPOINTS_H
+#define QT_ETHERSCAN_ENDPOINTS_H
+
+#include <QJsonObject>
+#include <QString>
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include "./types/qethsc_accountbalance.h"
+#include "./types/qethsc_dailyblocksize.h"
+#include "./types/qethsc_beaconchainwithdrawal.h"
+#include "./types/qethsc_block.h"
+#include "./types/qethsc_blockandunclerewards.h"
+#include "./types/qethsc_contractcreator.h"
+#include "./types/qethsc_contractexecutionstatus.h"
+#include "./types/qethsc_contractsourcecode.h"
+#include "./types/qethsc_dailyblockcountrewards.h"
+#include "./types/qethsc_dailyblocktime.h"
+#include "./types/qethsc_dailyblockrewards.h"
+#include "./types/qethsc_dailygaslimit.h"
+#include "./types/qethsc_dailygasprice.h"
+#include "./types/qethsc_dailymarketcap.h"
+#include "./types/qethsc_dailynetworkdifficulty.h"
+#include "./types/qethsc_dailynetworkhashrate.h"
+#include "./types/qethsc_dailynetworkutilization.h"
+#include "./types/qethsc_dailynewaddresscount.h"
+#include "./types/qethsc_dailytotalgas.h"
+#include "./types/qethsc_dailytransactioncount.h"
+#include "./types/qethsc_dailytransactionfees.h"
+#include "./types/qethsc_dailyunclecountrewards.h"
+#include "./types/qethsc_erc20tokenholder.h"
+#include "./types/qethsc_erc20tokenholding.h"
+#include "./types/qethsc_erc20tokentransferevent.h"
+#include "./types/qethsc_erc721tokeninventory.h"
+#include "./types/qethsc_erc721tokenholding.h"
+#include "./types/qethsc_erc721tokentransferevent.h"
+#include "./types/qethsc_erc1155tokentransferevent.h"
+#include "./types/qethsc_estimatedblockcountdown.h"
+#include "./types/qethsc_ether.h"
+#include "./types/qethsc_etherprice.h"
+#include "./types/qethsc_ether2supply.h"
+#include "./types/qethsc_etherhistoricalprice.h"
+#include "./types/qethsc_eventlogs.h"
+#include "./types/qethsc_gasoracle.h"
+#include "./types/qethsc_internaltransaction.h"
+#include "./types/qethsc_nodescount.h"
+#include "./types/qethsc_nodessize.h"
+#include "./types/qethsc_tokeninfo.h"
+#include "./types/qethsc_transaction.h"
+#include "./types/qethsc_enums.h"
+#include "./types/proxy/eth_blocknumber.h"
+#include "./types/proxy/eth_gasprice.h"
+#include "./types/proxy/eth_block.h"
+#include "./types/proxy/eth_transaction.h"
+#include "./types/proxy/eth_transactioncount.h"
+#include "./types/proxy/eth_transactionhash.h"
+#include "./types/proxy/eth_transactionreceipt.h"
+
+namespace QtEtherscan {
+
+/*! @namespace QtEtherscan::Endpoints
+ *  @brief Compile-time descriptors of Etherscan API endpoints. Each descriptor provides module, action, names of the
+ *         parameters, type of the result and flags of the endpoint. Descriptors are used by API::fetch method, flags
+ *         define default caching (CachePolicy::endpointDefaults), record filtering of paged lists and JSON-RPC
+ *         batching of proxy calls. Descriptors can also be used to configure CachePolicy, HedgingPolicy and
+ *         RequestScheduler for groups of endpoints.
+ *
+ *  @code
+ *  QtEtherscan::TransactionList list = etherscan.fetch<QtEtherscan::Endpoints::TxList>(
+ *      "0xde0b295669a9fd93d5f28d9ec85e40f4cb697bae",0,99999999,1,100,"asc");
+ *
+ *  QtEtherscan::CachePolicy policy;
+ *  QtEtherscan::Endpoints::forEach([&policy](auto endpoint) {
+ *      typedef decltype(endpoint) Endpoint;
+ *      if constexpr (Endpoint::isLatestData)
+ *          policy.setTtl<Endpoint>(1000,15000);
+ *  });
+ *  @endcode */
+
+namespace Endpoints {
+
+/*! @brief This enum describes properties of the endpoint. */
+enum Flag : unsigned {
+    NoFlags     = 0x00,  /*!< @brief Endpoint has no special properties */
+    ProxyModule = 0x01,  /*!< @brief Endpoint belongs to proxy module, its reply is JSON-RPC object and it can be batched
+                          *          when JSON-RPC node is used (see API::setJsonRpcUrl) */
+    LatestData  = 0x02,  /*!< @brief Reply describes latest state of the network and may be cached for a short time */
+    Immutable   = 0x04,  /*!< @brief Successful reply never changes and may be cached for a long time. Replies, which
+                          *          may be changed by chain reorganization (blocks, receipts), are not immutable */
+    Paged       = 0x08   /*!< @brief Endpoint has page and offset parameters */
+};
+
+/*! @brief Base of all endpoint descriptors. R is type of the result returned by API::fetch, N is number of the
+ *         parameters. */
+template<class R, unsigned Flags, std::size_t N>
+struct Endpoint
+{
+    typedef R Result;
+
+    static constexpr unsigned    flags = Flags;
+    static constexpr std::size_t parameterCount = N;
+    static constexpr bool        isProxy = (Flags & ProxyModule) != 0;
+    static constexpr bool        isLatestData = (Flags & LatestData) != 0;
+    static constexpr bool        isImmutable = (Flags & Immutable) != 0;
+    static constexpr bool        isPaged = (Flags & Paged) != 0;
+};
+
+/*! @brief Converts value of the endpoint parameter to its string representation. */
+inline QString queryValue(const QString& value)   { return value; }
+inline QString queryValue(QLatin1String value)    { return value; }
+inline QString queryValue(const char* value)      { return QString::fromUtf8(value); }
+inline QString queryValue(bool value)             { return value ? QStringLiteral("true") : QStringLiteral("false"); }
+
+template<class T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T,bool>>>
+inline QString queryValue(T value)                { return QString::number(value); }
+
+struct Balance : Endpoint<QtEtherscan::EtherBalance, NoFlags, 2> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "balance";
+    static constexpr std::array<const char*,2> parameters = {{ "tag", "address" }};
+};
+
+struct BalanceMulti : Endpoint<QtEtherscan::AccountBalanceList, NoFlags, 2> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "balancemulti";
+    static constexpr std::array<const char*,2> parameters = {{ "tag", "address" }};
+};
+
+struct TxList : Endpoint<QtEtherscan::TransactionList, Paged, 6> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "txlist";
+    static constexpr std::array<const char*,6> parameters = {{ "address", "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct TxListInternal : Endpoint<QtEtherscan::InternalTransactionList, Paged, 6> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "txlistinternal";
+    static constexpr std::array<const char*,6> parameters = {{ "address", "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct TxListInternalByHash : Endpoint<QtEtherscan::InternalTransactionList, NoFlags, 1> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "txlistinternal";
+    static constexpr std::array<const char*,1> parameters = {{ "txhash" }};
+};
+
+struct TxListInternalByBlockRange : Endpoint<QtEtherscan::InternalTransactionList, Paged, 5> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "txlistinternal";
+    static constexpr std::array<const char*,5> parameters = {{ "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct TokenTx : Endpoint<QtEtherscan::ERC20TokenTransferEventList, Paged, 5> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "tokentx";
+    static constexpr std::array<const char*,5> parameters = {{ "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct TokenNftTx : Endpoint<QtEtherscan::ERC721TokenTransferEventList, Paged, 5> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "tokennfttx";
+    static constexpr std::array<const char*,5> parameters = {{ "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct Token1155Tx : Endpoint<QtEtherscan::ERC1155TokenTransferEventList, Paged, 5> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "token1155tx";
+    static constexpr std::array<const char*,5> parameters = {{ "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct GetMinedBlocks : Endpoint<QtEtherscan::BlockList, Paged, 4> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "getminedblocks";
+    static constexpr std::array<const char*,4> parameters = {{ "address", "page", "offset", "blocktype" }};
+};
+
+struct TxsBeaconWithdrawal : Endpoint<QtEtherscan::BeaconChainWithdrawalList, Paged, 6> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "txsBeaconWithdrawal";
+    static constexpr std::array<const char*,6> parameters = {{ "address", "startblock", "endblock", "page", "offset", "sort" }};
+};
+
+struct BalanceHistory : Endpoint<QtEtherscan::EtherBalance, NoFlags, 2> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "balancehistory";
+    static constexpr std::array<const char*,2> parameters = {{ "address", "blockno" }};
+};
+
+struct GetAbi : Endpoint<QJsonObject, NoFlags, 1> {
+    static constexpr const char* module = "contract";
+    static constexpr const char* action = "getabi";
+    static constexpr std::array<const char*,1> parameters = {{ "address" }};
+};
+
+struct GetSourceCode : Endpoint<QtEtherscan::ContractSourceCode, NoFlags, 1> {
+    static constexpr const char* module = "contract";
+    static constexpr const char* action = "getsourcecode";
+    static constexpr std::array<const char*,1> parameters = {{ "address" }};
+};
+
+struct GetContractCreation : Endpoint<QtEtherscan::ContractCreatorList, Immutable, 1> {
+    static constexpr const char* module = "contract";
+    static constexpr const char* action = "getcontractcreation";
+    static constexpr std::array<const char*,1> parameters = {{ "contractaddresses" }};
+};
+
+struct GetStatus : Endpoint<QtEtherscan::ContractExecutionStatus, NoFlags, 1> {
+    static constexpr const char* module = "transaction";
+    static constexpr const char* action = "getstatus";
+    static constexpr std::array<const char*,1> parameters = {{ "txhash" }};
+};
+
+struct GetTxReceiptStatus : Endpoint<QJsonObject, NoFlags, 1> {
+    static constexpr const char* module = "transaction";
+    static constexpr const char* action = "gettxreceiptstatus";
+    static constexpr std::array<const char*,1> parameters = {{ "txhash" }};
+};
+
+struct GetBlockReward : Endpoint<QtEtherscan::BlockAndUncleRewards, NoFlags, 1> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "getblockreward";
+    static constexpr std::array<const char*,1> parameters = {{ "blockno" }};
+};
+
+struct GetBlockCountdown : Endpoint<QtEtherscan::EstimatedBlockCountdown, NoFlags, 1> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "getblockcountdown";
+    static constexpr std::array<const char*,1> parameters = {{ "blockno" }};
+};
+
+struct GetBlockNoByTime : Endpoint<qint64, NoFlags, 2> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "getblocknobytime";
+    static constexpr std::array<const char*,2> parameters = {{ "timestamp", "closest" }};
+};
+
+struct DailyAvgBlockSize : Endpoint<QtEtherscan::DailyBlockSizeList, NoFlags, 3> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "dailyavgblocksize";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyBlkCount : Endpoint<QtEtherscan::DailyBlockCountRewardsList, NoFlags, 3> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "dailyblkcount";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyBlockRewards : Endpoint<QtEtherscan::DailyBlockRewardsList, NoFlags, 3> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "dailyblockrewards";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyAvgBlockTime : Endpoint<QtEtherscan::DailyBlockTimeList, NoFlags, 3> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "dailyavgblocktime";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyUncleBlkCount : Endpoint<QtEtherscan::DailyUncleCountRewardsList, NoFlags, 3> {
+    static constexpr const char* module = "block";
+    static constexpr const char* action = "dailyuncleblkcount";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct GetLogs : Endpoint<QtEtherscan::EventLogList, Paged, 5> {
+    static constexpr const char* module = "logs";
+    static constexpr const char* action = "getLogs";
+    static constexpr std::array<const char*,5> parameters = {{ "address", "fromBlock", "toBlock", "page", "offset" }};
+};
+
+struct GetLogsByTopics : Endpoint<QtEtherscan::EventLogList, Paged, 4> {
+    static constexpr const char* module = "logs";
+    static constexpr const char* action = "getLogs";
+    static constexpr std::array<const char*,4> parameters = {{ "fromBlock", "toBlock", "page", "offset" }};
+};
+
+struct EthBlockNumber : Endpoint<QtEtherscan::Proxy::BlockNumberResponse, ProxyModule|LatestData, 0> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_blockNumber";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct EthGetBlockByNumber : Endpoint<QtEtherscan::Proxy::BlockResponse, ProxyModule, 2> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getBlockByNumber";
+    static constexpr std::array<const char*,2> parameters = {{ "tag", "boolean" }};
+};
+
+struct EthGetUncleByBlockNumberAndIndex : Endpoint<QtEtherscan::Proxy::BlockResponse, ProxyModule, 2> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getUncleByBlockNumberAndIndex";
+    static constexpr std::array<const char*,2> parameters = {{ "tag", "index" }};
+};
+
+struct EthGetBlockTransactionCountByNumber : Endpoint<QtEtherscan::Proxy::TransactionCountResponse, ProxyModule, 1> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getBlockTransactionCountByNumber";
+    static constexpr std::array<const char*,1> parameters = {{ "tag" }};
+};
+
+struct EthGetTransactionByHash : Endpoint<QtEtherscan::Proxy::TransactionResponse, ProxyModule, 1> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getTransactionByHash";
+    static constexpr std::array<const char*,1> parameters = {{ "txhash" }};
+};
+
+struct EthGetTransactionByBlockNumberAndIndex : Endpoint<QtEtherscan::Proxy::TransactionResponse, ProxyModule, 2> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getTransactionByBlockNumberAndIndex";
+    static constexpr std::array<const char*,2> parameters = {{ "tag", "index" }};
+};
+
+struct EthGetTransactionCount : Endpoint<QtEtherscan::Proxy::TransactionCountResponse, ProxyModule, 2> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getTransactionCount";
+    static constexpr std::array<const char*,2> parameters = {{ "address", "tag" }};
+};
+
+struct EthSendRawTransaction : Endpoint<QtEtherscan::Proxy::TransactionHashResponse, ProxyModule, 1> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_sendRawTransaction";
+    static constexpr std::array<const char*,1> parameters = {{ "hex" }};
+};
+
+struct EthGetTransactionReceipt : Endpoint<QtEtherscan::Proxy::TransactionReceiptResponse, ProxyModule, 1> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getTransactionReceipt";
+    static constexpr std::array<const char*,1> parameters = {{ "txhash" }};
+};
+
+/*! @brief Receipts of all transactions of the block. This method is not served by etherscan.io, it is supported only
+ *         by JSON-RPC nodes (see API::setJsonRpcUrl), so API::fetch returns raw reply. */
+struct EthGetBlockReceipts : Endpoint<QJsonObject, ProxyModule, 1> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getBlockReceipts";
+    static constexpr std::array<const char*,1> parameters = {{ "tag" }};
+};
+
+struct EthCall : Endpoint<QtEtherscan::Proxy::StringResponse, ProxyModule, 3> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_call";
+    static constexpr std::array<const char*,3> parameters = {{ "to", "data", "tag" }};
+};
+
+struct EthGetCode : Endpoint<QtEtherscan::Proxy::StringResponse, ProxyModule, 2> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getCode";
+    static constexpr std::array<const char*,2> parameters = {{ "address", "tag" }};
+};
+
+struct EthGetStorageAt : Endpoint<QtEtherscan::Proxy::StringResponse, ProxyModule, 3> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_getStorageAt";
+    static constexpr std::array<const char*,3> parameters = {{ "address", "position", "tag" }};
+};
+
+struct EthGasPrice : Endpoint<QtEtherscan::Proxy::GasPriceResponse, ProxyModule|LatestData, 0> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_gasPrice";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct EthEstimateGas : Endpoint<QtEtherscan::Proxy::StringResponse, ProxyModule, 5> {
+    static constexpr const char* module = "proxy";
+    static constexpr const char* action = "eth_estimateGas";
+    static constexpr std::array<const char*,5> parameters = {{ "data", "to", "value", "gasPrice", "gas" }};
+};
+
+struct TokenSupply : Endpoint<QString, NoFlags, 1> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "tokensupply";
+    static constexpr std::array<const char*,1> parameters = {{ "contractaddress" }};
+};
+
+struct TokenBalance : Endpoint<QString, NoFlags, 3> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "tokenbalance";
+    static constexpr std::array<const char*,3> parameters = {{ "contractaddress", "tag", "address" }};
+};
+
+struct TokenSupplyHistory : Endpoint<QString, NoFlags, 2> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "tokensupplyhistory";
+    static constexpr std::array<const char*,2> parameters = {{ "contractaddress", "blockno" }};
+};
+
+struct TokenBalanceHistory : Endpoint<QString, NoFlags, 3> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "tokenbalancehistory";
+    static constexpr std::array<const char*,3> parameters = {{ "contractaddress", "blockno", "address" }};
+};
+
+struct TokenHolderList : Endpoint<QtEtherscan::ERC20TokenHolderList, Paged, 3> {
+    static constexpr const char* module = "token";
+    static constexpr const char* action = "tokenholderlist";
+    static constexpr std::array<const char*,3> parameters = {{ "contractaddress", "page", "offset" }};
+};
+
+struct TokenInfo : Endpoint<QtEtherscan::TokenInfo, NoFlags, 1> {
+    static constexpr const char* module = "token";
+    static constexpr const char* action = "tokeninfo";
+    static constexpr std::array<const char*,1> parameters = {{ "contractaddress" }};
+};
+
+struct AddressTokenBalance : Endpoint<QtEtherscan::ERC20TokenHoldingList, Paged, 3> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "addresstokenbalance";
+    static constexpr std::array<const char*,3> parameters = {{ "address", "page", "offset" }};
+};
+
+struct AddressTokenNftBalance : Endpoint<QtEtherscan::ERC721TokenHoldingList, Paged, 3> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "addresstokennftbalance";
+    static constexpr std::array<const char*,3> parameters = {{ "address", "page", "offset" }};
+};
+
+struct AddressTokenNftInventory : Endpoint<QtEtherscan::ERC721TokenInventoryList, Paged, 4> {
+    static constexpr const char* module = "account";
+    static constexpr const char* action = "addresstokennftinventory";
+    static constexpr std::array<const char*,4> parameters = {{ "contractaddress", "address", "page", "offset" }};
+};
+
+struct GasEstimate : Endpoint<qint64, NoFlags, 1> {
+    static constexpr const char* module = "gastracker";
+    static constexpr const char* action = "gasestimate";
+    static constexpr std::array<const char*,1> parameters = {{ "gaspreice" }};
+};
+
+struct GasOracle : Endpoint<QtEtherscan::GasOracle, LatestData, 0> {
+    static constexpr const char* module = "gastracker";
+    static constexpr const char* action = "gasoracle";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct DailyAvgGasLimit : Endpoint<QtEtherscan::DailyGasLimitList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailyavggaslimit";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyGasUsed : Endpoint<QtEtherscan::DailyTotalGasList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailygasused";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyAvgGasPrice : Endpoint<QtEtherscan::DailyGasPriceList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailyavggasprice";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct EthSupply : Endpoint<QtEtherscan::EtherBalance, NoFlags, 0> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "ethsupply";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct EthSupply2 : Endpoint<QtEtherscan::Ether2Supply, NoFlags, 0> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "ethsupply2";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct EthPrice : Endpoint<QtEtherscan::EtherPrice, LatestData, 0> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "ethprice";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct ChainSize : Endpoint<QtEtherscan::NodesSize, NoFlags, 5> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "chainsize";
+    static constexpr std::array<const char*,5> parameters = {{ "startdate", "enddate", "clienttype", "syncmode", "sort" }};
+};
+
+struct NodeCount : Endpoint<QtEtherscan::NodesCount, NoFlags, 0> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "nodecount";
+    static constexpr std::array<const char*,0> parameters = {{  }};
+};
+
+struct DailyTxnFee : Endpoint<QtEtherscan::DailyTransactionFeesList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailytxnfee";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyNewAddress : Endpoint<QtEtherscan::DailyNewAddressCountList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailynewaddress";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyNetUtilization : Endpoint<QtEtherscan::DailyNetworkUtilizationList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailynetutilization";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyAvgHashrate : Endpoint<QtEtherscan::DailyNetworkHashrateList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailyavghashrate";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyTx : Endpoint<QtEtherscan::DailyTransactionCountList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailytx";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct DailyAvgNetDifficulty : Endpoint<QtEtherscan::DailyNetworkDifficultyList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "dailyavgnetdifficulty";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct EthDailyMarketCap : Endpoint<QtEtherscan::DailyMarketCapList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "ethdailymarketcap";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+struct EthDailyPrice : Endpoint<QtEtherscan::EtherHistoricalPriceList, NoFlags, 3> {
+    static constexpr const char* module = "stats";
+    static constexpr const char* action = "ethdailyprice";
+    static constexpr std::array<const char*,3> parameters = {{ "startdate", "enddate", "sort" }};
+};
+
+/*! @brief List of all endpoint descriptors. */
+typedef std::tuple<
+    Balance,
+    BalanceMulti,
+    TxList,
+    TxListInternal,
+    TxListInternalByHash,
+    TxListInternalByBlockRange,
+    TokenTx,
+    TokenNftTx,
+    Token1155Tx,
+    GetMinedBlocks,
+    TxsBeaconWithdrawal,
+    BalanceHistory,
+    GetAbi,
+    GetSourceCode,
+    GetContractCreation,
+    GetStatus,
+    GetTxReceiptStatus,
+    GetBlockReward,
+    GetBlockCountdown,
+    GetBlockNoByTime,
+    DailyAvgBlockSize,
+    DailyBlkCount,
+    DailyBlockRewards,
+    DailyAvgBlockTime,
+    DailyUncleBlkCount,
+    GetLogs,
+    GetLogsByTopics,
+    EthBlockNumber,
+    EthGetBlockByNumber,
+    EthGetUncleByBlockNumberAndIndex,
+    EthGetBlockTransactionCountByNumber,
+    EthGetTransactionByHash,
+    EthGetTransactionByBlockNumberAndIndex,
+    EthGetTransactionCount,
+    EthSendRawTransaction,
+    EthGetTransactionReceipt,
+    EthGetBlockReceipts,
+    EthCall,
+    EthGetCode,
+    EthGetStorageAt,
+    EthGasPrice,
+    EthEstimateGas,
+    TokenSupply,
+    TokenBalance,
+    TokenSupplyHistory,
+    TokenBalanceHistory,
+    TokenHolderList,
+    TokenInfo,
+    AddressTokenBalance,
+    AddressTokenNftBalance,
+    AddressTokenNftInventory,
+    GasEstimate,
+    GasOracle,
+    DailyAvgGasLimit,
+    DailyGasUsed,
+    DailyAvgGasPrice,
+    EthSupply,
+    EthSupply2,
+    EthPrice,
+    ChainSize,
+    NodeCount,
+    DailyTxnFee,
+    DailyNewAddress,
+    DailyNetUtilization,
+    DailyAvgHashrate,
+    DailyTx,
+    DailyAvgNetDifficulty,
+    EthDailyMarketCap,
+    EthDailyPrice
+> All;
+
+/*! @brief Calls f with default-constructed object of each endpoint descriptor. */
+template<class F>
+void forEach(F f)
+{
+    std::apply([&f](auto... endpoints) { (f(endpoints), ...); },All());
+}
+
+} // namespace Endpoints
+
+} // namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_ENDPOINTS_H
@@ -0,0 +1,124 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_HEDGINGPOLICY_H
+#define QT_ETHERSCAN_HEDGINGPOLICY_H
+
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QUrlQuery>
+
+#include "./qethsc_querytemplate.h"
+
+namespace QtEtherscan {
+
+/*! @class HedgingPolicy src/qethsc_hedgingpolicy.h
+ *  @brief This class describes for which API actions hedged requests should be made.
+ *  @details If reply for the request to one of the hedged actions was not received within delay, equal to the
+ *           configured percentile of latencies observed for this action - duplicate request is sent. If alternative
+ *           API keys are provided - duplicate request will use next key from this list. First successful reply is
+ *           used, other request is aborted. Each duplicate request consumes extra quota, amount of such requests can
+ *           be checked with API::hedgedRequestCount. By default hedging is disabled.
+ *
+ *  @code
+ *  etherscan.setHedgingPolicy(QtEtherscan::HedgingPolicy::latencyCritical());
+ *  @endcode */
+
+class HedgingPolicy
+{
+public:
+    /*! @brief Constructs HedgingPolicy object with hedging disabled for all actions. */
+    HedgingPolicy() :
+        m_percentile{0.95}, m_minimumDelay{50}, m_initialDelay{500}, m_minimumSamples{16} {}
+
+    /*! @brief Returns HedgingPolicy with hedging enabled for eth_getTransactionReceipt, eth_blockNumber and
+     *         gasoracle actions. */
+    static HedgingPolicy latencyCritical() {
+        HedgingPolicy policy;
+        policy.setActions({
+            QLatin1String("eth_getTransactionReceipt"),
+            QLatin1String("eth_blockNumber"),
+            QLatin1String("gasoracle")
+        });
+        return policy;
+    }
+
+    /*! @brief Returns true if hedging is enabled for at least one action. */
+    bool           isEnabled() const                       { return !m_actions.isEmpty(); }
+
+    /*! @brief Returns true if hedging is enabled for the specified action (e.g. "eth_blockNumber"). */
+    bool           isEnabledFor(const QString& action) const { return m_actions.contains(action); }
+
+    /*! @brief Returns set of actions for which hedging is enabled. */
+    QSet<QString>  actions() const                         { return m_actions; }
+    void           setActions(const QSet<QString>& actions){ m_actions = actions; }
+    void           addAction(const QString& action)        { m_actions.insert(action); }
+    void           removeAction(const QString& action)     { m_actions.remove(action); }
+
+    /*! @brief Enables hedging for the endpoint described by E (see QtEtherscan::Endpoints). Other endpoints with the
+     *         same action are not affected. */
+    template<class E>
+    void           addAction()                             { addAction(QueryTemplate::endpointKey<E>()); }
+    template<class E>
+    void           removeAction()                          { removeAction(QueryTemplate::endpointKey<E>()); }
+
+    /*! @brief Returns true if hedging is enabled for the action or for the endpoint of the query. */
+    bool           isEnabledFor(const QUrlQuery& query) const {
+        return !m_actions.isEmpty() && (m_actions.contains(query.queryItemValue(QLatin1String("action")))
+                                        || m_actions.contains(QueryTemplate::endpointKey(query)));
+    }
+
+    /*! @brief Returns percentile (0.0-1.0) of observed latency, after which duplicate request is sent. Default is 0.95 */
+    double         percentile() const                      { return m_percentile; }
+    void           setPercentile(double percentile)        { m_percentile = qBound(0.0,percentile,1.0); }
+
+    /*! @brief Returns minimal delay (in mseconds) before sending duplicate request. Default is 50 ms. */
+    quint32        minimumDelay() const                    { return m_minimumDelay; }
+    void           setMinimumDelay(quint32 msec)           { m_minimumDelay = msec; }
+
+    /*! @brief Returns delay (in mseconds) which is used until enough latency samples are collected. Default is 500 ms. */
+    quint32        initialDelay() const                    { return m_initialDelay; }
+    void           setInitialDelay(quint32 msec)           { m_initialDelay = msec; }
+
+    /*! @brief Returns amount of latency samples needed before percentile is used. Default is 16. */
+    int            minimumSamples() const                  { return m_minimumSamples; }
+    void           setMinimumSamples(int count)            { m_minimumSamples = count; }
+
+    /*! @brief Returns list of API keys, which are used for duplicate requests. If empty - same key is used. */
+    QStringList    apiKeys() const                         { return m_apiKeys; }
+    void           setApiKeys(const QStringList& keys)     { m_apiKeys = keys; }
+
+private:
+    QSet<QString>  m_actions;
+    double         m_percentile;
+    quint32        m_minimumDelay;
+    quint32        m_initialDelay;
+    int            m_minimumSamples;
+    QStringList    m_apiKeys;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_HEDGINGPOLICY_H
@@ -0,0 +1,110 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_jsonrpc.h"
+
+#include <QJsonDocument>
+
+namespace QtEtherscan {
+
+QJsonObject JsonRpc::request(const QString& method, const QJsonArray& params, qint64 id)
+{
+    return QJsonObject({
+        { QLatin1String("jsonrpc"),    QLatin1String("2.0") },
+        { QLatin1String("id"),         id },
+        { QLatin1String("method"),     method },
+        { QLatin1String("params"),     params }
+    });
+}
+
+QJsonObject JsonRpc::requestFromQuery(const QUrlQuery& query, qint64 id)
+{
+    const QString action = query.queryItemValue(QLatin1String("action"));
+    auto item = [&query](const char* name) -> QJsonValue {
+        return query.queryItemValue(QLatin1String(name));
+    };
+
+    QJsonArray params;
+    if (action == QLatin1String("eth_getBlockByNumber")) {
+        params = { item("tag"), query.queryItemValue(QLatin1String("boolean")) == QLatin1String("true") };
+    } else if (action == QLatin1String("eth_getUncleByBlockNumberAndIndex") ||
+               action == QLatin1String("eth_getTransactionByBlockNumberAndIndex")) {
+        params = { item("tag"), item("index") };
+    } else if (action == QLatin1String("eth_getBlockTransactionCountByNumber") ||
+               action == QLatin1String("eth_getBlockReceipts")) {
+        params = { item("tag") };
+    } else if (action == QLatin1String("eth_getTransactionByHash") ||
+               action == QLatin1String("eth_getTransactionReceipt")) {
+        params = { item("txhash") };
+    } else if (action == QLatin1String("eth_getTransactionCount") ||
+               action == QLatin1String("eth_getCode")) {
+        params = { item("address"), item("tag") };
+    } else if (action == QLatin1String("eth_getStorageAt")) {
+        params = { item("address"), item("position"), item("tag") };
+    } else if (action == QLatin1String("eth_sendRawTransaction")) {
+        params = { item("hex") };
+    } else if (action == QLatin1String("eth_call")) {
+        params = { QJsonObject({ { QLatin1String("to"), item("to") }, { QLatin1String("data"), item("data") } }),
+                   item("tag") };
+    } else if (action == QLatin1String("eth_estimateGas")) {
+        // Only parameters which were actually passed are included into the call object
+        QJsonObject call;
+        for (const char* name : { "to", "data", "value", "gasPrice", "gas" }) {
+            const QString value = query.queryItemValue(QLatin1String(name));
+            if (!value.isEmpty())
+                call.insert(QLatin1String(name),value);
+        }
+        params = { call };
+    }
+
+    return request(action,params,id);
+}
+
+QList<QJsonObject> JsonRpc::splitBatchReply(const QByteArray& data, int count)
+{
+    QList<QJsonObject> result;
+    result.reserve(count);
+    for (int i = 0; i < count; i++)
+        result.append(QJsonObject());
+
+    const QJsonDocument document = QJsonDocument::fromJson(data);
+    if (!document.isArray()) {
+        for (int i = 0; i < count; i++)
+            result[i] = document.object();
+        return result;
+    }
+
+    // Replies in the batch may come in any order
+    const QJsonArray replies = document.array();
+    for (const QJsonValue& reply : replies) {
+        const QJsonObject replyObject = reply.toObject();
+        const qint64 id = replyObject.value("id").toVariant().toLongLong();
+        if (id >= 0 && id < count)
+            result[static_cast<int>(id)] = replyObject;
+    }
+
+    return result;
+}
+
+} //namespace QtEtherscan
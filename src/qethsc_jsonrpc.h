@@ -0,0 +1,61 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_JSONRPC_H
+#define QT_ETHERSCAN_JSONRPC_H
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QList>
+#include <QUrlQuery>
+
+namespace QtEtherscan {
+
+/*! @class JsonRpc src/qethsc_jsonrpc.h
+ *  @brief This class converts requests to the etherscan.io "proxy" module into native JSON-RPC requests. For internal
+ *         use only.
+ *  @details Replies of JSON-RPC nodes have the same structure as replies of the etherscan.io "proxy" module, so they
+ *           are parsed by the same Proxy::Response classes. */
+
+class JsonRpc
+{
+public:
+    /*! @brief Returns JSON-RPC request object for the method with params. */
+    static QJsonObject        request(const QString& method, const QJsonArray& params, qint64 id);
+
+    /*! @brief Returns JSON-RPC request object equivalent to the query for the etherscan.io "proxy" module. */
+    static QJsonObject        requestFromQuery(const QUrlQuery& query, qint64 id);
+
+    /*! @brief Splits reply to the batch request into list of replies, ordered by their "id" field (0..count-1). Missing
+     *         replies are represented with empty QJsonObject. If reply is not an array (e.g. server does not support
+     *         batches and returned single error) - it is returned for each request. */
+    static QList<QJsonObject> splitBatchReply(const QByteArray& data, int count);
+
+private:
+    JsonRpc() {}
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_JSONRPC_H
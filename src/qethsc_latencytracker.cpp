@@ -0,0 +1,64 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_latencytracker.h"
+
+#include <algorithm>
+
+namespace QtEtherscan {
+
+LatencyTracker::LatencyTracker(int windowSize) :
+    m_windowSize{qMax(1,windowSize)}
+{}
+
+void LatencyTracker::addSample(const QString& action, qint64 msec)
+{
+    Window& window = m_windows[action];
+    if (window.samples.size() < m_windowSize) {
+        window.samples.append(msec);
+    } else {
+        window.samples[window.next] = msec;
+        window.next = (window.next + 1) % m_windowSize;
+    }
+}
+
+int LatencyTracker::sampleCount(const QString& action) const
+{
+    auto i = m_windows.constFind(action);
+    return (i == m_windows.constEnd()) ? 0 : i->samples.size();
+}
+
+qint64 LatencyTracker::percentile(const QString& action, double fraction, qint64 defaultValue) const
+{
+    auto i = m_windows.constFind(action);
+    if (i == m_windows.constEnd() || i->samples.isEmpty())
+        return defaultValue;
+
+    QVector<qint64> samples = i->samples;
+    const int index = qBound(0,int(fraction * (samples.size() - 1) + 0.5),samples.size() - 1);
+    std::nth_element(samples.begin(),samples.begin() + index,samples.end());
+    return samples.at(index);
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,67 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_LATENCYTRACKER_H
+#define QT_ETHERSCAN_LATENCYTRACKER_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace QtEtherscan {
+
+/*! @class LatencyTracker src/qethsc_latencytracker.h
+ *  @brief This class keeps a rolling window of observed request latencies for every API action and is able to
+ *         calculate percentiles over them. For internal use only. */
+
+class LatencyTracker
+{
+public:
+    explicit LatencyTracker(int windowSize = 128);
+
+    /*! @brief Adds latency sample (in mseconds) for the specified action. Oldest sample is dropped when window is full. */
+    void      addSample(const QString& action, qint64 msec);
+
+    /*! @brief Returns amount of samples currently stored for the specified action. */
+    int       sampleCount(const QString& action) const;
+
+    /*! @brief Returns latency (in mseconds), which is not exceeded by the given fraction (0.0-1.0) of observed
+     *         requests. If there are no samples for the action - defaultValue is returned. */
+    qint64    percentile(const QString& action, double fraction, qint64 defaultValue) const;
+
+    void      clear()                                      { m_windows.clear(); }
+
+private:
+    struct Window {
+        QVector<qint64> samples;
+        int             next = 0;
+    };
+
+    QHash<QString,Window>  m_windows;
+    int                    m_windowSize;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_LATENCYTRACKER_H
@@ -25,40 +25,102 @@
 #include "qethsc_networking.h"
 
 #include <QEventLoop>
-#include <QNetworkReply>
-#include <QTimer>
 #include <QUrlQuery>
 
+#include "qethsc_pendingrequest.h"
+
 namespace QtEtherscan {
 
 Networking::Networking(QObject* parent) :
     QObject{parent},
-    m_timeout{0}
+    m_timeout{0},
+    m_maxReplySize{0},
+    m_defaultScheduler{new RequestScheduler(this)},
+    m_scheduler{m_defaultScheduler},
+    m_nextHedgingKey{0},
+    m_hedgedRequestCount{0},
+    m_hedgeWinCount{0}
 {}
 
-QByteArray Networking::request(const QUrlQuery& query)
+QByteArray Networking::request(const QUrlQuery& query, const RequestContext& context, RequestStatus* status)
 {
-    QNetworkRequest req;
-    QUrl url(m_host);
-    url.setQuery(query);
-    req.setUrl(url);
+    return waitFor([&](const RequestCallback& callback) { return send(query,context,callback); },status);
+}
 
+PendingRequest* Networking::send(const QUrlQuery& query, const RequestContext& context, const RequestCallback& callback)
+{
+    PendingRequest* request = new PendingRequest(this,query,context,callback);
+    request->start();
+    return request;
+}
+
+QByteArray Networking::requestJsonRpc(const QUrl& url, const QByteArray& body, const RequestContext& context, RequestStatus* status)
+{
+    return waitFor([&](const RequestCallback& callback) { return sendJsonRpc(url,body,context,callback); },status);
+}
+
+PendingRequest* Networking::sendJsonRpc(const QUrl& url, const QByteArray& body, const RequestContext& context, const RequestCallback& callback)
+{
+    PendingRequest* request = new PendingRequest(this,url,body,context,callback);
+    request->start();
+    return request;
+}
+
+QByteArray Networking::waitFor(const std::function<PendingRequest*(const RequestCallback&)>& start, RequestStatus* status)
+{
     QEventLoop waitLoop;
+    bool finished = false;
+    RequestStatus requestStatus = RequestFinished;
+    QByteArray result;
 
-    if (m_timeout != 0)
-        QTimer::singleShot(m_timeout,&waitLoop,&QEventLoop::quit);
+    start([&](const QByteArray& data, RequestStatus replyStatus) {
+        result = data;
+        requestStatus = replyStatus;
+        finished = true;
+        waitLoop.quit();
+    });
 
-    QNetworkReply *reply = m_nam.get(req);
-    QObject::connect(reply, &QNetworkReply::finished, &waitLoop, &QEventLoop::quit);
+    if (!finished)
+        waitLoop.exec();
 
-    waitLoop.exec();
-    if (reply->isRunning())
-        reply->abort();
+    if (status != nullptr)
+        *status = requestStatus;
 
-    QByteArray result = reply->readAll();
+    return result;
+}
 
-    reply->deleteLater();
+QNetworkRequest Networking::buildRequest(const QUrlQuery& query, const QString& host) const
+{
+    // Default host is parsed only once, when it is set
+    QUrl url(host.isEmpty() ? m_hostUrl : QUrl(host));
+    url.setQuery(query);
+    return QNetworkRequest(url);
+}
+
+QUrlQuery Networking::hedgedQuery(const QUrlQuery& query)
+{
+    const QStringList keys = m_hedgingPolicy.apiKeys();
+    if (keys.isEmpty())
+        return query;
+
+    QUrlQuery result(query);
+    const QString currentKey = query.queryItemValue(QLatin1String("apikey"));
+    QString key = keys.at(m_nextHedgingKey++ % keys.size());
+    if (key == currentKey && keys.size() > 1)
+        key = keys.at(m_nextHedgingKey++ % keys.size());
+
+    result.removeAllQueryItems(QLatin1String("apikey"));
+    result.addQueryItem(QLatin1String("apikey"),key);
     return result;
 }
 
+qint64 Networking::hedgingDelay(const QString& action) const
+{
+    if (m_latency.sampleCount(action) < m_hedgingPolicy.minimumSamples())
+        return qMax<qint64>(m_hedgingPolicy.initialDelay(),m_hedgingPolicy.minimumDelay());
+
+    return qMax<qint64>(m_latency.percentile(action,m_hedgingPolicy.percentile(),m_hedgingPolicy.initialDelay()),
+                        m_hedgingPolicy.minimumDelay());
+}
+
 } //namespace QtEtherscan
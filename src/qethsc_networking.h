@@ -29,9 +29,20 @@
 
 #include <QNetworkProxy>
 #include <QNetworkAccessManager>
+#include <QPointer>
+#include <QUrl>
+
+#include <functional>
+
+#include "./qethsc_hedgingpolicy.h"
+#include "./qethsc_latencytracker.h"
+#include "./qethsc_requestcontext.h"
+#include "./qethsc_requestscheduler.h"
 
 namespace QtEtherscan {
 
+class PendingRequest;
+
 /*! @class Networking src/qethsc_networking.h
  *  @brief This class a bit simplifies communication with Etherscan API servers.
  *         For internal use only. */
@@ -41,13 +52,42 @@ class Networking : public QObject
     Q_OBJECT
 protected:
     friend class API;
+    friend class PendingRequest;
+
+    /*! @brief This enum describes how request to Etherscan API servers was finished. */
+    enum RequestStatus {
+        RequestFinished,      /*!< @brief Reply was received from server */
+        RequestFailed,        /*!< @brief Network error has happened */
+        RequestTimedOut,      /*!< @brief Request was aborted, because Networking::requestTimeout has expired */
+        RequestDeadlineExpired, /*!< @brief Request was aborted, because deadline of its RequestContext has expired */
+        RequestCancelled,     /*!< @brief Request was aborted, because its CancellationToken was cancelled */
+        RequestTooLarge       /*!< @brief Request was aborted, because its reply exceeded maxReplySize() */
+    };
+
+    typedef std::function<void(const QByteArray& data, RequestStatus status)> RequestCallback;
 
     explicit Networking(QObject* parent = nullptr);
     ~Networking() {}
 
-    void           setApiHost(const QString& host)         { m_host = host; }
+    void           setApiHost(const QString& host)         { m_host = host; m_hostUrl = QUrl(host); }
+    QString        apiHost() const                         { return m_host; }
+
+    /*! @brief Makes request and waits for its completion. */
+    QByteArray     request(const QUrlQuery& params, const RequestContext& context, RequestStatus* status = nullptr);
+
+    /*! @brief Starts request and returns immediately. Callback is invoked exactly once, after request is finished,
+     *         unless this Networking object is destroyed before. Returned object is deleted after callback invocation. */
+    PendingRequest* send(const QUrlQuery& params, const RequestContext& context, const RequestCallback& callback);
+
+    /*! @brief Makes JSON-RPC POST request to the url and waits for its completion. */
+    QByteArray     requestJsonRpc(const QUrl& url, const QByteArray& body, const RequestContext& context,
+                                  RequestStatus* status = nullptr);
 
-    QByteArray     request(const QUrlQuery& params);
+    /*! @brief Starts JSON-RPC POST request to the url and returns immediately. Such requests are not limited by
+     *         RequestScheduler, as they are not made to Etherscan API servers. Deadline and cancellation token from
+     *         the context are respected. */
+    PendingRequest* sendJsonRpc(const QUrl& url, const QByteArray& body, const RequestContext& context,
+                                const RequestCallback& callback);
 
     void           setProxy(const QNetworkProxy& newProxy) { m_nam.setProxy(newProxy); }
     QNetworkProxy  proxy() const                           { return m_nam.proxy(); }
@@ -55,10 +95,41 @@ protected:
     quint32        requestTimeout() const                  { return m_timeout; };
     void           setRequestTimeout(quint32 newTimeout)   { m_timeout = newTimeout; };
 
+    /*! @brief Returns maximal size (in bytes) of the reply body. 0 means no limit. */
+    qint64         maxReplySize() const                    { return m_maxReplySize; }
+    void           setMaxReplySize(qint64 bytes)           { m_maxReplySize = qMax<qint64>(0,bytes); }
+
+    RequestScheduler* requestScheduler() const             { return m_scheduler.isNull() ? m_defaultScheduler : m_scheduler.data(); }
+    void           setRequestScheduler(RequestScheduler* scheduler) { m_scheduler = scheduler ? scheduler : m_defaultScheduler; }
+
+    HedgingPolicy  hedgingPolicy() const                   { return m_hedgingPolicy; }
+    void           setHedgingPolicy(const HedgingPolicy& policy) { m_hedgingPolicy = policy; m_nextHedgingKey = 0; }
+
+    quint64        hedgedRequestCount() const              { return m_hedgedRequestCount; }
+    quint64        hedgeWinCount() const                   { return m_hedgeWinCount; }
+    void           resetHedgingStatistics()                { m_hedgedRequestCount = 0; m_hedgeWinCount = 0; }
+
 private:
+    QByteArray               waitFor(const std::function<PendingRequest*(const RequestCallback&)>& start,
+                                     RequestStatus* status);
+    QNetworkRequest          buildRequest(const QUrlQuery& query, const QString& host = QString()) const;
+    QUrlQuery                hedgedQuery(const QUrlQuery& query);
+    qint64                   hedgingDelay(const QString& action) const;
+
     QNetworkAccessManager    m_nam;
     QString                  m_host;
+    QUrl                     m_hostUrl;
     quint32                  m_timeout;
+    qint64                   m_maxReplySize;
+
+    RequestScheduler*            m_defaultScheduler;
+    QPointer<RequestScheduler>   m_scheduler;
+
+    HedgingPolicy            m_hedgingPolicy;
+    LatencyTracker           m_latency;
+    int                      m_nextHedgingKey;
+    quint64                  m_hedgedRequestCount;
+    quint64                  m_hedgeWinCount;
 };
 
 } //namespace QtEtherscan
@@ -0,0 +1,199 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_paralleldecoding.h"
+
+#include <QAtomicInt>
+#include <QMutex>
+#include <QObject>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
+
+#include <memory>
+
+namespace QtEtherscan {
+
+static QAtomicInt s_maxThreads(1);
+static QAtomicInt s_minItems(2000);
+
+// Smallest chunk, for which passing it to another thread pays off
+static constexpr int MinChunkSize = 256;
+
+namespace {
+
+struct ParallelState
+{
+    ParallelState(int count, const std::function<void(int)>& task) :
+        next{0}, count{count}, task{task} {}
+
+    // Caller and helpers take indexes one by one, so faster threads take more work
+    void run() {
+        for (int index = next.fetchAndAddOrdered(1); index < count; index = next.fetchAndAddOrdered(1))
+            task(index);
+    }
+
+    QAtomicInt                        next;
+    const int                         count;
+    const std::function<void(int)>&   task;
+    QSemaphore                        finished;
+};
+
+class ParallelHelper : public QRunnable
+{
+public:
+    ParallelHelper(ParallelState* state) :
+        m_state{state} {}
+
+    void run() override {
+        m_state->run();
+        m_state->finished.release();
+    }
+
+private:
+    ParallelState* m_state;
+};
+
+class DeliveryRelay;
+
+// Worker thread posts result only while relay is alive, so relay deleted together with its receiver is never used
+struct DeliveryState
+{
+    QMutex                            mutex;
+    DeliveryRelay*                    relay = nullptr;
+};
+
+class DeliveryRelay : public QObject
+{
+public:
+    DeliveryRelay(QObject* receiver, const std::shared_ptr<DeliveryState>& state) :
+        QObject{receiver}, m_state{state} {
+        m_state->relay = this;
+    }
+
+    ~DeliveryRelay() {
+        QMutexLocker locker(&m_state->mutex);
+        m_state->relay = nullptr;
+    }
+
+private:
+    std::shared_ptr<DeliveryState> m_state;
+};
+
+class BackgroundDecoder : public QRunnable
+{
+public:
+    BackgroundDecoder(const std::shared_ptr<DeliveryState>& state, const std::function<void()>& decode,
+                      const std::function<void()>& deliver) :
+        m_state{state}, m_decode{decode}, m_deliver{deliver} {}
+
+    void run() override {
+        m_decode();
+
+        QMutexLocker locker(&m_state->mutex);
+        if (m_state->relay == nullptr)
+            return;
+
+        DeliveryRelay* relay = m_state->relay;
+        const std::function<void()> deliver = m_deliver;
+        QMetaObject::invokeMethod(relay, [relay,deliver]() {
+            relay->deleteLater();
+            deliver();
+        }, Qt::QueuedConnection);
+    }
+
+private:
+    std::shared_ptr<DeliveryState> m_state;
+    std::function<void()>          m_decode;
+    std::function<void()>          m_deliver;
+};
+
+} //namespace
+
+void ParallelDecoding::setMaxThreads(int threads)
+{
+    s_maxThreads.storeRelease(qMax(1,threads));
+}
+
+int ParallelDecoding::maxThreads()
+{
+    return s_maxThreads.loadAcquire();
+}
+
+void ParallelDecoding::setMinItems(int items)
+{
+    s_minItems.storeRelease(qMax(1,items));
+}
+
+int ParallelDecoding::minItems()
+{
+    return s_minItems.loadAcquire();
+}
+
+bool ParallelDecoding::isEnabledFor(int itemCount)
+{
+    return maxThreads() > 1 && itemCount >= minItems() && itemCount >= 2 * MinChunkSize;
+}
+
+int ParallelDecoding::chunkCount(int itemCount)
+{
+    // Few chunks per thread let threads, which were started later, to take their share
+    return qBound(1,itemCount / MinChunkSize,maxThreads() * 4);
+}
+
+void ParallelDecoding::forEach(int count, const std::function<void(int index)>& task)
+{
+    ParallelState state(count,task);
+
+    int helpers = 0;
+    const int maxHelpers = qMin(maxThreads(),count) - 1;
+    for (; helpers < maxHelpers; helpers++) {
+        ParallelHelper* helper = new ParallelHelper(&state);
+        if (!QThreadPool::globalInstance()->tryStart(helper)) {
+            delete helper;
+            break;
+        }
+    }
+
+    state.run();
+    state.finished.acquire(helpers);
+}
+
+void ParallelDecoding::forEachChunk(int itemCount, const std::function<void(int begin, int end)>& task)
+{
+    const int chunks = chunkCount(itemCount);
+    forEach(chunks,[itemCount,chunks,&task](int chunk) {
+        task(int(qint64(itemCount) * chunk / chunks),int(qint64(itemCount) * (chunk + 1) / chunks));
+    });
+}
+
+void ParallelDecoding::decodeInBackground(QObject* receiver, const std::function<void()>& decode,
+                                          const std::function<void()>& deliver)
+{
+    std::shared_ptr<DeliveryState> state = std::make_shared<DeliveryState>();
+    new DeliveryRelay(receiver,state);
+    QThreadPool::globalInstance()->start(new BackgroundDecoder(state,decode,deliver));
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,84 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_PARALLELDECODING_H
+#define QT_ETHERSCAN_PARALLELDECODING_H
+
+#include <QtGlobal>
+
+#include <functional>
+
+class QObject;
+
+namespace QtEtherscan {
+
+/*! @class ParallelDecoding src/qethsc_paralleldecoding.h
+ *  @brief This class holds process-wide settings of parallel decoding of large list replies. When it is enabled -
+ *         arrays of JsonObjectsList, flat list replies and transactions of Proxy::Block are split into chunks, which
+ *         are decoded by threads of QThreadPool::globalInstance() and the calling thread. Order of the elements is
+ *         preserved.
+ *  @details Parallel decoding is disabled by default. Lists decoded with StringPool are always decoded on the calling
+ *           thread, as StringPool is not thread-safe. If global thread pool has no free threads - calling thread
+ *           decodes all chunks itself, so decoding never waits for unrelated tasks.
+ *  @code
+ *  QtEtherscan::ParallelDecoding::setMaxThreads(QThread::idealThreadCount());
+ *  QtEtherscan::ParallelDecoding::setMinItems(2000);
+ *  @endcode */
+
+class ParallelDecoding
+{
+public:
+    /*! @brief Sets maximal number of threads (including calling one) used to decode single list. 1 disables parallel
+     *         decoding. */
+    static void    setMaxThreads(int threads);
+    static int     maxThreads();
+
+    /*! @brief Sets minimal number of elements in the list, which is decoded in parallel. Default is 2000. */
+    static void    setMinItems(int items);
+    static int     minItems();
+
+    /*! @brief Returns true if list of itemCount elements should be decoded in parallel. */
+    static bool    isEnabledFor(int itemCount);
+
+    /*! @brief Returns number of chunks, in which list of itemCount elements is split. */
+    static int     chunkCount(int itemCount);
+
+    /*! @brief Calls task for each index from 0 to count - 1 using calling thread and up to maxThreads() - 1 threads of
+     *         global QThreadPool. Returns when all tasks are finished. */
+    static void    forEach(int count, const std::function<void(int index)>& task);
+
+    /*! @brief Splits itemCount elements in chunkCount(itemCount) chunks and calls task for each of them in parallel.
+     *         Task gets range [begin,end) of the elements. */
+    static void    forEachChunk(int itemCount, const std::function<void(int begin, int end)>& task);
+
+    /*! @brief Calls decode in the thread of global QThreadPool and then deliver in the thread of receiver. It is used
+     *         to decode one reply, while next ones are downloaded. If receiver is deleted before decoding is finished
+     *         - deliver is not called. */
+    static void    decodeInBackground(QObject* receiver, const std::function<void()>& decode,
+                                      const std::function<void()>& deliver);
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_PARALLELDECODING_H
@@ -0,0 +1,307 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_pendingrequest.h"
+
+#include <chrono>
+#include <limits>
+#include <utility>
+
+namespace QtEtherscan {
+
+PendingRequest::PendingRequest(Networking* networking, const QUrlQuery& query, const RequestContext& context,
+                               const Networking::RequestCallback& callback) :
+    QObject{networking},
+    m_net{networking},
+    m_query{query},
+    m_action{query.queryItemValue(QLatin1String("action"))},
+    m_context{context},
+    m_deadline{context.deadline()},
+    m_callback{callback},
+    m_ticket{0},
+    m_granted{false},
+    m_acquiredSlots{0},
+    m_deadlineIsTimeout{false},
+    m_finished{false}
+{
+    init();
+}
+
+PendingRequest::PendingRequest(Networking* networking, const QUrl& url, const QByteArray& body,
+                               const RequestContext& context, const Networking::RequestCallback& callback) :
+    QObject{networking},
+    m_net{networking},
+    m_url{url},
+    m_body{body},
+    m_context{context},
+    m_deadline{context.deadline()},
+    m_callback{callback},
+    m_ticket{0},
+    m_granted{false},
+    m_acquiredSlots{0},
+    m_deadlineIsTimeout{false},
+    m_finished{false}
+{
+    init();
+}
+
+void PendingRequest::init()
+{
+    // Expired global timeout says that server is slow, while expired deadline of the caller does not
+    if (m_net->m_timeout != 0) {
+        const QDeadlineTimer timeout(m_net->m_timeout);
+        if (timeout < m_deadline) {
+            m_deadline = timeout;
+            m_deadlineIsTimeout = true;
+        }
+    }
+
+    m_deadlineTimer.setSingleShot(true);
+    connect(&m_deadlineTimer, &QTimer::timeout, this, [this]() {
+        finish(m_deadlineIsTimeout ? Networking::RequestTimedOut : Networking::RequestDeadlineExpired);
+    });
+
+    m_hedgingTimer.setSingleShot(true);
+    connect(&m_hedgingTimer, &QTimer::timeout, this, &PendingRequest::sendHedgedRequest);
+}
+
+PendingRequest::~PendingRequest()
+{
+    // Destroyed together with Networking object. Callback is not invoked.
+    releaseResources();
+}
+
+void PendingRequest::start()
+{
+    if (m_context.isCancelled()) {
+        finishLater(Networking::RequestCancelled);
+        return;
+    }
+
+    if (m_deadline.hasExpired()) {
+        finishLater(Networking::RequestDeadlineExpired);
+        return;
+    }
+
+    if (!m_deadline.isForever())
+        m_deadlineTimer.start(std::chrono::milliseconds(m_deadline.remainingTime()));
+
+    if (m_context.cancellationToken() != nullptr) {
+        connect(m_context.cancellationToken(), &CancellationToken::cancelled,
+                this, [this]() { finish(Networking::RequestCancelled); });
+
+        // Token might have been cancelled from other thread before we have connected to it.
+        if (m_context.isCancelled()) {
+            finishLater(Networking::RequestCancelled);
+            return;
+        }
+    }
+
+    // JSON-RPC requests go to user's own node, so they are not limited by scheduler of Etherscan API requests.
+    if (!m_url.isEmpty()) {
+        onGranted();
+        return;
+    }
+
+    // Waiting for our turn in the scheduler queue. Callback may be invoked right from enqueue.
+    m_scheduler = m_net->requestScheduler();
+    const RequestScheduler::Priority priority = m_context.hasPriority() ? m_context.priority()
+                                                                        : m_scheduler->queryPriority(m_query);
+    m_ticket = m_scheduler->enqueue(priority,m_context.consumer(),[this]() { onGranted(); });
+}
+
+void PendingRequest::onGranted()
+{
+    // Each sent request occupies one slot of the scheduler concurrency window
+    m_granted = true;
+    m_acquiredSlots = 1;
+
+    if (m_url.isEmpty()) {
+        m_primaryReply = m_net->m_nam.get(m_net->buildRequest(m_query,m_context.apiUrl()));
+    } else {
+        QNetworkRequest request(m_url);
+        request.setHeader(QNetworkRequest::ContentTypeHeader,QLatin1String("application/json"));
+        m_primaryReply = m_net->m_nam.post(request,m_body);
+    }
+    m_primaryElapsed.start();
+    watchReply(m_primaryReply);
+
+    if (m_url.isEmpty() && m_net->m_hedgingPolicy.isEnabledFor(m_query))
+        m_hedgingTimer.start(std::chrono::milliseconds(m_net->hedgingDelay(m_action)));
+}
+
+void PendingRequest::sendHedgedRequest()
+{
+    if (m_finished || m_primaryReply.isNull() || m_primaryReply->isFinished())
+        return;
+
+    // Duplicate request is made only if there is spare rate budget
+    if (m_scheduler.isNull() || !m_scheduler->tryAcquire())
+        return;
+
+    m_acquiredSlots++;
+    m_hedgedReply = m_net->m_nam.get(m_net->buildRequest(m_net->hedgedQuery(m_query),m_context.apiUrl()));
+    watchReply(m_hedgedReply);
+    m_net->m_hedgedRequestCount++;
+}
+
+void PendingRequest::watchReply(QNetworkReply* reply)
+{
+    connect(reply, &QNetworkReply::metaDataChanged, this, [this,reply]() { onReplyMetaData(reply); });
+    connect(reply, &QNetworkReply::readyRead, this, [this,reply]() { onReplyReadyRead(reply); });
+    connect(reply, &QNetworkReply::finished, this, [this,reply]() { onReplyFinished(reply); });
+}
+
+void PendingRequest::onReplyMetaData(QNetworkReply* reply)
+{
+    if (m_finished)
+        return;
+
+    // Reply, which announces too large body, is aborted before downloading it
+    const qint64 contentLength = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+    if (exceedsMaxReplySize(contentLength)) {
+        finish(Networking::RequestTooLarge);
+        return;
+    }
+
+    // Compressed replies are longer than announced, so this only saves first reallocations
+    if (contentLength > 0 && contentLength < std::numeric_limits<int>::max())
+        replyBody(reply).reserve(static_cast<int>(contentLength));
+}
+
+void PendingRequest::onReplyReadyRead(QNetworkReply* reply)
+{
+    if (m_finished)
+        return;
+
+    QByteArray& body = replyBody(reply);
+    body.append(reply->readAll());
+    if (exceedsMaxReplySize(body.size()))
+        finish(Networking::RequestTooLarge);
+}
+
+void PendingRequest::onReplyFinished(QNetworkReply* reply)
+{
+    if (m_finished)
+        return;
+
+    // Resources are released by finish, so body is moved out before
+    QByteArray body = std::move(replyBody(reply));
+    body.append(reply->readAll());
+    if (exceedsMaxReplySize(body.size())) {
+        finish(Networking::RequestTooLarge);
+        return;
+    }
+
+    // First successful reply wins. Failed reply is used only if there is nothing else to wait for.
+    const bool isPrimary = (reply == m_primaryReply.data());
+    if (reply->error() == QNetworkReply::NoError) {
+        if (!isPrimary)
+            m_net->m_hedgeWinCount++;
+
+        finish(Networking::RequestFinished,body);
+        return;
+    }
+
+    QNetworkReply* otherReply = isPrimary ? m_hedgedReply.data() : m_primaryReply.data();
+    if (otherReply == nullptr || otherReply->isFinished())
+        finish(Networking::RequestFailed,body);
+}
+
+QByteArray& PendingRequest::replyBody(QNetworkReply* reply)
+{
+    return (reply == m_primaryReply.data()) ? m_primaryBody : m_hedgedBody;
+}
+
+bool PendingRequest::exceedsMaxReplySize(qint64 size) const
+{
+    return m_net->m_maxReplySize > 0 && size > m_net->m_maxReplySize;
+}
+
+void PendingRequest::finishLater(Networking::RequestStatus status)
+{
+    QMetaObject::invokeMethod(this, [this,status]() { finish(status); }, Qt::QueuedConnection);
+}
+
+void PendingRequest::finish(Networking::RequestStatus status, const QByteArray& data)
+{
+    if (m_finished)
+        return;
+    m_finished = true;
+
+    recordLatency(status);
+    releaseResources();
+
+    Networking::RequestCallback callback = std::move(m_callback);
+    m_callback = nullptr;
+    if (callback)
+        callback(data,status);
+
+    deleteLater();
+}
+
+void PendingRequest::recordLatency(Networking::RequestStatus status)
+{
+    // Sample is the time of the primary request, even if hedged one has won or primary has failed or timed out.
+    // Samples of the winners only (or timed from sending of the hedged request) would make hedging fire too early.
+    if (!m_url.isEmpty() || !m_primaryElapsed.isValid())
+        return;
+
+    if (status == Networking::RequestFinished || status == Networking::RequestFailed ||
+            status == Networking::RequestTimedOut)
+        m_net->m_latency.addSample(m_action,m_primaryElapsed.elapsed());
+}
+
+void PendingRequest::releaseResources()
+{
+    m_deadlineTimer.stop();
+    m_hedgingTimer.stop();
+
+    if (!m_granted && !m_scheduler.isNull())
+        m_scheduler->cancel(m_ticket);
+    m_granted = true;
+
+    // Aborting reply also releases everything which was already downloaded, partial data is not returned.
+    for (QNetworkReply* reply : { m_primaryReply.data(), m_hedgedReply.data() }) {
+        if (reply == nullptr)
+            continue;
+
+        reply->disconnect(this);
+        if (reply->isRunning())
+            reply->abort();
+        reply->deleteLater();
+    }
+    m_primaryReply.clear();
+    m_hedgedReply.clear();
+    m_primaryBody.clear();
+    m_hedgedBody.clear();
+
+    if (!m_scheduler.isNull()) {
+        for (int i = 0; i < m_acquiredSlots; i++)
+            m_scheduler->release();
+    }
+    m_acquiredSlots = 0;
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,107 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_PENDINGREQUEST_H
+#define QT_ETHERSCAN_PENDINGREQUEST_H
+
+#include <QObject>
+
+#include <QElapsedTimer>
+#include <QNetworkReply>
+#include <QPointer>
+#include <QTimer>
+#include <QUrlQuery>
+
+#include "./qethsc_networking.h"
+
+namespace QtEtherscan {
+
+/*! @class PendingRequest src/qethsc_pendingrequest.h
+ *  @brief Object of this class represents single request to Etherscan API servers, which is in progress. It waits
+ *         for its turn in RequestScheduler, sends request (and hedged duplicate if needed) and watches for deadline
+ *         and cancellation token. Reply body is taken from QNetworkReply as soon as it arrives, so it is stored only
+ *         once, and request is aborted as soon as body exceeds Networking::maxReplySize. For internal use only,
+ *         created by Networking::send. */
+
+class PendingRequest : public QObject
+{
+    Q_OBJECT
+public:
+    ~PendingRequest();
+
+    /*! @brief Aborts this request. Callback is invoked with Networking::RequestCancelled status. */
+    void           abort()                                 { finish(Networking::RequestCancelled); }
+
+private:
+    friend class Networking;
+
+    PendingRequest(Networking* networking, const QUrlQuery& query, const RequestContext& context,
+                   const Networking::RequestCallback& callback);
+    PendingRequest(Networking* networking, const QUrl& url, const QByteArray& body, const RequestContext& context,
+                   const Networking::RequestCallback& callback);
+
+    void           init();
+    void           start();
+    void           onGranted();
+    void           sendHedgedRequest();
+    void           watchReply(QNetworkReply* reply);
+    void           onReplyMetaData(QNetworkReply* reply);
+    void           onReplyReadyRead(QNetworkReply* reply);
+    void           onReplyFinished(QNetworkReply* reply);
+    QByteArray&    replyBody(QNetworkReply* reply);
+    bool           exceedsMaxReplySize(qint64 size) const;
+    void           finishLater(Networking::RequestStatus status);
+    void           finish(Networking::RequestStatus status, const QByteArray& data = QByteArray());
+    void           recordLatency(Networking::RequestStatus status);
+    void           releaseResources();
+
+    Networking*                  m_net;
+    QUrlQuery                    m_query;
+    QUrl                         m_url;
+    QByteArray                   m_body;
+    QString                      m_action;
+    RequestContext               m_context;
+    QDeadlineTimer               m_deadline;
+    Networking::RequestCallback  m_callback;
+
+    QPointer<RequestScheduler>   m_scheduler;
+    quint64                      m_ticket;
+    bool                         m_granted;
+    int                          m_acquiredSlots;
+
+    QTimer                       m_deadlineTimer;
+    QTimer                       m_hedgingTimer;
+    QPointer<QNetworkReply>      m_primaryReply;
+    QPointer<QNetworkReply>      m_hedgedReply;
+    QByteArray                   m_primaryBody;
+    QByteArray                   m_hedgedBody;
+    QElapsedTimer                m_primaryElapsed;
+
+    bool                         m_deadlineIsTimeout;
+    bool                         m_finished;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_PENDINGREQUEST_H
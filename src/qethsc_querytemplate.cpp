@@ -0,0 +1,87 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_querytemplate.h"
+
+namespace QtEtherscan {
+
+QueryTemplate::QueryTemplate(const char* module, const char* action, const char* const* parameters, int parameterCount)
+    : m_action{QLatin1String(action)},m_apiKeyParameter{QLatin1String("apikey")}
+{
+    m_parameters.reserve(parameterCount);
+    for (int i = 0; i < parameterCount; i++)
+        m_parameters.append(QLatin1String(parameters[i]));
+
+    m_prefix.addQueryItem(QLatin1String("module"),QLatin1String(module));
+    m_prefix.addQueryItem(QLatin1String("action"),m_action);
+}
+
+QUrlQuery QueryTemplate::query(std::initializer_list<QString> values, const QString& apiKey) const
+{
+    Q_ASSERT_X(int(values.size()) == m_parameters.size(),"QueryTemplate::query","Wrong number of values");
+
+    // Copy of the prefix shares already encoded module and action items, names of the parameters are converted to
+    // QString only once
+    QUrlQuery result(m_prefix);
+
+    auto name = m_parameters.cbegin();
+    for (const QString& value : values)
+        result.addQueryItem(*name++,value);
+
+    if (!apiKey.isEmpty())
+        result.addQueryItem(m_apiKeyParameter,apiKey);
+
+    return result;
+}
+
+static QString joinEndpointKey(const QString& action, QStringList parameters)
+{
+    parameters.sort();
+    return action + QLatin1Char('?') + parameters.join(QLatin1Char('&'));
+}
+
+QString QueryTemplate::endpointKey(const char* action, const char* const* parameters, int parameterCount)
+{
+    QStringList names;
+    names.reserve(parameterCount);
+    for (int i = 0; i < parameterCount; i++)
+        names.append(QLatin1String(parameters[i]));
+
+    return joinEndpointKey(QLatin1String(action),names);
+}
+
+QString QueryTemplate::endpointKey(const QUrlQuery& query)
+{
+    QStringList names;
+    const QList<QPair<QString,QString>> items = query.queryItems();
+    for (const QPair<QString,QString>& item : items) {
+        if (item.first != QLatin1String("module") && item.first != QLatin1String("action")
+                && item.first != QLatin1String("chainid") && item.first != QLatin1String("apikey"))
+            names.append(item.first);
+    }
+
+    return joinEndpointKey(query.queryItemValue(QLatin1String("action")),names);
+}
+
+} // namespace QtEtherscan
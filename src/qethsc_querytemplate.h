@@ -0,0 +1,80 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_QUERYTEMPLATE_H
+#define QT_ETHERSCAN_QUERYTEMPLATE_H
+
+#include <QString>
+#include <QStringList>
+#include <QUrlQuery>
+
+#include <initializer_list>
+
+namespace QtEtherscan {
+
+/*! @class QueryTemplate src/qethsc_querytemplate.h
+ *  @brief Object of this class describes query of the single API endpoint: its module, action and names of the
+ *         parameters. Query with module and action is encoded only once, when template is created, and is shared
+ *         by all queries built from it. Templates are created once for each endpoint descriptor (see
+ *         QtEtherscan::Endpoints) and reused for each call. For internal use only. */
+
+class QueryTemplate
+{
+public:
+    QueryTemplate(const char* module, const char* action, const char* const* parameters = nullptr,
+                  int parameterCount = 0);
+
+    /*! @brief Returns action of this endpoint (e.g. "txlist"). */
+    QString        action() const                          { return m_action; }
+
+    /*! @brief Returns names of the parameters of this endpoint in the order in which values are passed to query. */
+    QStringList    parameters() const                      { return m_parameters; }
+
+    /*! @brief Returns query for this endpoint. Values are passed in the order of the template parameters. If apiKey
+     *         is not empty - it is appended to the query. */
+    QUrlQuery      query(std::initializer_list<QString> values, const QString& apiKey = QString()) const;
+
+    /*! @brief Returns key, which identifies endpoint by its action and names of the parameters (e.g.
+     *         "getLogs?fromBlock&offset&page&toBlock"). Used to configure CachePolicy, HedgingPolicy and
+     *         RequestScheduler for single endpoint, when several endpoints share the same action. */
+    static QString endpointKey(const char* action, const char* const* parameters, int parameterCount);
+
+    /*! @brief Returns key of the endpoint described by E (see QtEtherscan::Endpoints). */
+    template<class E>
+    static QString endpointKey()                           { return endpointKey(E::action,E::parameters.data(),int(E::parameterCount)); }
+
+    /*! @brief Returns key of the endpoint to which query is made. Items, which are added to every query (module,
+     *         action, chainid and apikey), are not taken into account. */
+    static QString endpointKey(const QUrlQuery& query);
+
+private:
+    QString        m_action;
+    QStringList    m_parameters;
+    QString        m_apiKeyParameter;
+    QUrlQuery      m_prefix;
+};
+
+} // namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_QUERYTEMPLATE_H
@@ -0,0 +1,107 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_REQUESTCONTEXT_H
+#define QT_ETHERSCAN_REQUESTCONTEXT_H
+
+#include <QDeadlineTimer>
+#include <QPointer>
+#include <QStringList>
+
+#include "./qethsc_cancellationtoken.h"
+#include "./qethsc_requestscheduler.h"
+#include "./types/qethsc_recordfilter.h"
+#include "./types/qethsc_stringpool.h"
+
+namespace QtEtherscan {
+
+/*! @class RequestContext src/qethsc_requestcontext.h
+ *  @brief This class holds per-request parameters (deadline, cancellation token, priority, consumer, network, field
+ *         projection, record filter, string pool), which are applied to the requests made by API object. For internal use only, use RequestScope to change them. */
+
+class RequestContext
+{
+public:
+    RequestContext() :
+        m_deadline{QDeadlineTimer::Forever}, m_priority{RequestScheduler::Normal}, m_hasPriority{false},
+        m_network{-1}, m_stringPool{nullptr} {}
+
+    /*! @brief Returns deadline, after which requests will be aborted with API::TimeoutError. */
+    QDeadlineTimer       deadline() const                              { return m_deadline; }
+    void                 setDeadline(const QDeadlineTimer& deadline)   { m_deadline = deadline; }
+
+    /*! @brief Returns CancellationToken, which can be used to abort requests. Can be nullptr. */
+    CancellationToken*   cancellationToken() const                     { return m_cancellationToken.data(); }
+    void                 setCancellationToken(CancellationToken* token){ m_cancellationToken = token; }
+
+    /*! @brief Returns true if the token associated with this context was cancelled. */
+    bool                 isCancelled() const                           { return m_cancellationToken && m_cancellationToken->isCancelled(); }
+
+    /*! @brief Returns true if priority was explicitly set. Otherwise RequestScheduler::queryPriority is used. */
+    bool                 hasPriority() const                           { return m_hasPriority; }
+    RequestScheduler::Priority priority() const                        { return m_priority; }
+    void                 setPriority(RequestScheduler::Priority priority) { m_priority = priority; m_hasPriority = true; }
+
+    /*! @brief Returns name of the component which makes requests. Used by RequestScheduler for fair queuing. */
+    QString              consumer() const                              { return m_consumer; }
+    void                 setConsumer(const QString& consumer)          { m_consumer = consumer; }
+
+    /*! @brief Returns true if network was explicitly set. Otherwise API::etheriumNetwork is used. */
+    bool                 hasNetwork() const                            { return m_network >= 0; }
+    /*! @brief Returns network of the request - value from API::Network enum. */
+    int                  network() const                               { return m_network; }
+    void                 setNetwork(int network)                       { m_network = network; }
+
+    /*! @brief Returns URL to which request is sent. If empty - URL set by API::setEtheriumNetwork is used. */
+    QString              apiUrl() const                                { return m_apiUrl; }
+    void                 setApiUrl(const QString& url)                 { m_apiUrl = url; }
+
+    /*! @brief Returns names of the fields, which are decoded from list replies. If empty - all fields are decoded. */
+    QStringList          fields() const                                { return m_fields; }
+    void                 setFields(const QStringList& fields)          { m_fields = fields; }
+
+    /*! @brief Returns filter, which objects of paged list replies must match. If empty - all objects are returned. */
+    RecordFilter         recordFilter() const                          { return m_recordFilter; }
+    void                 setRecordFilter(const RecordFilter& filter)   { m_recordFilter = filter; }
+
+    /*! @brief Returns StringPool, which is used to share repeating values of list replies. Can be nullptr. */
+    StringPool*          stringPool() const                            { return m_stringPool; }
+    void                 setStringPool(StringPool* pool)               { m_stringPool = pool; }
+
+private:
+    QDeadlineTimer               m_deadline;
+    QPointer<CancellationToken>  m_cancellationToken;
+    RequestScheduler::Priority   m_priority;
+    bool                         m_hasPriority;
+    QString                      m_consumer;
+    int                          m_network;
+    QString                      m_apiUrl;
+    QStringList                  m_fields;
+    RecordFilter                 m_recordFilter;
+    StringPool*                  m_stringPool;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_REQUESTCONTEXT_H
@@ -0,0 +1,341 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_requestscheduler.h"
+
+#include <QtMath>
+
+namespace QtEtherscan {
+
+RequestScheduler::RequestScheduler(QObject* parent) :
+    QObject{parent},
+    m_rate{0},
+    m_burst{1},
+    m_tokens{1},
+    m_lastRefill{0},
+    m_consumerFairness{true},
+    m_nextTicket{1},
+    m_concurrencyLimit{0},
+    m_interactiveReserve{1},
+    m_inFlight{0},
+    m_adaptive{false},
+    m_window{1},
+    m_minimumRate{1},
+    m_maximumRate{50},
+    m_minimumConcurrency{1},
+    m_maximumConcurrency{16},
+    m_additiveIncrease{1},
+    m_multiplicativeDecrease{0.5},
+    m_lastDecrease{-1}
+{
+    m_lanes[Normal].weight = 4;
+    m_lanes[Bulk].weight = 1;
+
+    m_clock.start();
+
+    m_dispatchTimer.setSingleShot(true);
+    connect(&m_dispatchTimer, &QTimer::timeout, this, &RequestScheduler::dispatch);
+}
+
+void RequestScheduler::setRate(double requestsPerSecond)
+{
+    refill();
+    m_rate = qMax(0.0,requestsPerSecond);
+    dispatch();
+}
+
+void RequestScheduler::setBurst(int burst)
+{
+    m_burst = qMax(1,burst);
+    m_tokens = qMin(m_tokens,double(m_burst));
+}
+
+RequestScheduler::Priority RequestScheduler::queryPriority(const QUrlQuery& query) const
+{
+    if (m_actionPriorities.isEmpty())
+        return Normal;
+
+    const auto endpoint = m_actionPriorities.constFind(QueryTemplate::endpointKey(query));
+    if (endpoint != m_actionPriorities.constEnd())
+        return endpoint.value();
+
+    return actionPriority(query.queryItemValue(QLatin1String("action")));
+}
+
+void RequestScheduler::setLaneWeight(Priority priority, int weight)
+{
+    m_lanes[priority].weight = qMax(1,weight);
+}
+
+int RequestScheduler::concurrencyLimit() const
+{
+    return m_adaptive ? int(m_window) : m_concurrencyLimit;
+}
+
+void RequestScheduler::setConcurrencyLimit(int limit)
+{
+    m_concurrencyLimit = qMax(0,limit);
+    dispatch();
+}
+
+void RequestScheduler::setInteractiveReserve(int slots)
+{
+    m_interactiveReserve = qMax(0,slots);
+    dispatch();
+}
+
+void RequestScheduler::setAdaptive(bool enabled)
+{
+    if (m_adaptive == enabled)
+        return;
+
+    m_adaptive = enabled;
+    if (m_adaptive) {
+        if (m_rate <= 0)
+            setRate(qMax(5.0,m_minimumRate));
+        m_rate = qBound(m_minimumRate,m_rate,m_maximumRate);
+        m_window = qBound<double>(m_minimumConcurrency,(m_concurrencyLimit > 0) ? m_concurrencyLimit : 1,m_maximumConcurrency);
+        emit windowChanged(m_rate,concurrencyLimit());
+    }
+
+    dispatch();
+}
+
+void RequestScheduler::setRateBounds(double minimum, double maximum)
+{
+    m_minimumRate = qMax(0.01,minimum);
+    m_maximumRate = qMax(m_minimumRate,maximum);
+    if (m_adaptive)
+        m_rate = qBound(m_minimumRate,m_rate,m_maximumRate);
+}
+
+void RequestScheduler::setConcurrencyBounds(int minimum, int maximum)
+{
+    m_minimumConcurrency = qMax(1,minimum);
+    m_maximumConcurrency = qMax(m_minimumConcurrency,maximum);
+    if (m_adaptive)
+        m_window = qBound<double>(m_minimumConcurrency,m_window,m_maximumConcurrency);
+}
+
+void RequestScheduler::reportSuccess()
+{
+    if (!m_adaptive)
+        return;
+
+    const int previousLimit = concurrencyLimit();
+    refill();
+
+    // Additive increase: about additiveIncrease requests per second for each second of successful requests and one
+    // more request in flight for each window of successful requests.
+    m_rate = qMin(m_maximumRate,m_rate + m_additiveIncrease / m_rate);
+    m_window = qMin<double>(m_maximumConcurrency,m_window + 1.0 / m_window);
+
+    if (concurrencyLimit() != previousLimit)
+        dispatch();
+
+    emit windowChanged(m_rate,concurrencyLimit());
+}
+
+void RequestScheduler::reportOverload()
+{
+    if (!m_adaptive)
+        return;
+
+    // Requests which were in flight together will fail together. Only first of them reduces the window.
+    const qint64 now = m_clock.elapsed();
+    if (m_lastDecrease >= 0 && now - m_lastDecrease < qMax<qint64>(1000,qCeil(1000.0 / m_rate)))
+        return;
+    m_lastDecrease = now;
+
+    refill();
+    m_rate = qMax(m_minimumRate,m_rate * m_multiplicativeDecrease);
+    m_window = qMax<double>(m_minimumConcurrency,m_window * m_multiplicativeDecrease);
+    m_tokens = 0;
+
+    emit windowChanged(m_rate,concurrencyLimit());
+}
+
+int RequestScheduler::queuedCount() const
+{
+    int result = 0;
+    for (const Lane& lane : m_lanes)
+        result += lane.count;
+    return result;
+}
+
+quint64 RequestScheduler::enqueue(Priority priority, const QString& consumer, const std::function<void()>& callback)
+{
+    const quint64 ticket = m_nextTicket++;
+    const QString key = m_consumerFairness ? consumer : QString();
+
+    Lane& lane = m_lanes[priority];
+    QQueue<Ticket>& queue = lane.queues[key];
+    if (queue.isEmpty())
+        lane.consumers.append(key);
+
+    queue.enqueue({ticket,callback});
+    lane.count++;
+    m_locations.insert(ticket,{priority,key});
+
+    dispatch();
+    return ticket;
+}
+
+void RequestScheduler::cancel(quint64 ticket)
+{
+    auto location = m_locations.find(ticket);
+    if (location == m_locations.end())
+        return;
+
+    Lane& lane = m_lanes[location->priority];
+    auto queue = lane.queues.find(location->consumer);
+    if (queue != lane.queues.end()) {
+        for (auto i = queue->begin(); i != queue->end(); i++) {
+            if (i->id == ticket) {
+                queue->erase(i);
+                lane.count--;
+                break;
+            }
+        }
+
+        if (queue->isEmpty()) {
+            lane.consumers.removeOne(location->consumer);
+            lane.queues.erase(queue);
+        }
+    }
+
+    m_locations.erase(location);
+}
+
+bool RequestScheduler::tryAcquire()
+{
+    if (queuedCount() > 0 || !hasFreeSlot(Normal) || !takeToken())
+        return false;
+
+    m_inFlight++;
+    return true;
+}
+
+void RequestScheduler::release()
+{
+    if (m_inFlight > 0)
+        m_inFlight--;
+
+    dispatch();
+}
+
+void RequestScheduler::dispatch()
+{
+    m_dispatchTimer.stop();
+
+    // If there is no free slot - dispatch will be called again from release()
+    forever {
+        const bool interactive = m_lanes[Interactive].count > 0 && hasFreeSlot(Interactive);
+        if (!interactive && (m_lanes[Normal].count + m_lanes[Bulk].count == 0 || !hasFreeSlot(Normal)))
+            return;
+
+        if (!takeToken()) {
+            // Wake up when next token will be available
+            m_dispatchTimer.start(qMax(1,qCeil((1.0 - m_tokens) * 1000.0 / m_rate)));
+            return;
+        }
+
+        Ticket ticket = takeTicket(m_lanes[interactive ? int(Interactive) : nextLane()]);
+        m_inFlight++;
+        ticket.callback();
+    }
+}
+
+void RequestScheduler::refill()
+{
+    const qint64 now = m_clock.elapsed();
+    if (m_rate > 0)
+        m_tokens = qMin(double(m_burst),m_tokens + (now - m_lastRefill) * m_rate / 1000.0);
+    m_lastRefill = now;
+}
+
+bool RequestScheduler::hasFreeSlot(Priority priority) const
+{
+    const int limit = concurrencyLimit();
+    if (limit <= 0)
+        return true;
+
+    // Interactive requests may use reserved slots above the limit
+    return m_inFlight < ((priority == Interactive) ? limit + m_interactiveReserve : limit);
+}
+
+bool RequestScheduler::takeToken()
+{
+    if (m_rate <= 0)
+        return true;
+
+    refill();
+    if (m_tokens < 1.0)
+        return false;
+
+    m_tokens -= 1.0;
+    return true;
+}
+
+int RequestScheduler::nextLane()
+{
+    if (m_lanes[Interactive].count > 0)
+        return Interactive;
+
+    // Smooth weighted round-robin between Normal and Bulk lanes
+    int totalWeight = 0;
+    int result = -1;
+    for (int priority = Normal; priority < LaneCount; priority++) {
+        Lane& lane = m_lanes[priority];
+        if (lane.count == 0)
+            continue;
+
+        lane.currentWeight += lane.weight;
+        totalWeight += lane.weight;
+        if (result == -1 || lane.currentWeight > m_lanes[result].currentWeight)
+            result = priority;
+    }
+
+    Q_ASSERT(result != -1);
+    m_lanes[result].currentWeight -= totalWeight;
+    return result;
+}
+
+RequestScheduler::Ticket RequestScheduler::takeTicket(Lane& lane)
+{
+    const QString consumer = lane.consumers.takeFirst();
+    QQueue<Ticket>& queue = lane.queues[consumer];
+
+    Ticket ticket = queue.dequeue();
+    if (queue.isEmpty())
+        lane.queues.remove(consumer);
+    else
+        lane.consumers.append(consumer);
+
+    lane.count--;
+    m_locations.remove(ticket.id);
+    return ticket;
+}
+
+} //namespace QtEtherscan
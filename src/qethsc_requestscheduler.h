@@ -0,0 +1,257 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_REQUESTSCHEDULER_H
+#define QT_ETHERSCAN_REQUESTSCHEDULER_H
+
+#include <QObject>
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QQueue>
+#include <QTimer>
+#include <QUrlQuery>
+
+#include <functional>
+
+#include "./qethsc_querytemplate.h"
+
+namespace QtEtherscan {
+
+/*! @class RequestScheduler src/qethsc_requestscheduler.h
+ *  @brief This class limits the rate of requests sent to etherscan.io servers and decides in which order queued
+ *         requests are sent.
+ *  @details Requests are placed into one of three lanes (RequestScheduler::Priority). Requests from Interactive lane
+ *           always receive next available token, so they are sent within one token interval even if other lanes are
+ *           saturated. Normal and Bulk lanes share the rest of the rate budget according to their weights. Within each
+ *           lane requests of different consumers (see RequestScope) are served in round-robin order, so one consumer
+ *           can not starve the others.
+ *
+ *           Scheduler can also limit amount of requests being in progress at the same time (concurrency limit).
+ *           Interactive lane may exceed this limit by RequestScheduler::interactiveReserve slots, so that latency-sensitive
+ *           requests do not wait for completion of Normal and Bulk ones. In
+ *           adaptive mode (RequestScheduler::setAdaptive) both rate and concurrency limit are adjusted automatically:
+ *           they grow additively while requests succeed and are reduced multiplicatively when API reports
+ *           API::MaxRateError, API::NetworkError or API::TimeoutError caused by API::requestTimeout (deadlines of
+ *           RequestScope are chosen by caller and are not counted). This way scheduler converges to the maximal
+ *           throughput sustainable with the current plan and server load.
+ *
+ *           By default rate is not limited and requests are sent immediately. Single RequestScheduler object can be
+ *           shared by several API objects (API::setRequestScheduler) living in the same thread, so all of them will
+ *           use one rate budget.
+ *
+ *  @code
+ *  QtEtherscan::RequestScheduler scheduler;
+ *  scheduler.setRate(5);                                   // Free etherscan.io plan
+ *  scheduler.setActionPriority("eth_sendRawTransaction", QtEtherscan::RequestScheduler::Interactive);
+ *  etherscan.setRequestScheduler(&scheduler);
+ *  @endcode */
+
+class RequestScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    /*! @brief This enum describes priority lanes of the scheduler. */
+    enum Priority {
+        Interactive,   /*!< @brief Latency-sensitive requests. Always served first. */
+        Normal,        /*!< @brief Default priority. */
+        Bulk           /*!< @brief Backfills and other background jobs. */
+    };
+    Q_ENUM(Priority)
+
+    explicit RequestScheduler(QObject* parent = nullptr);
+    ~RequestScheduler() {}
+
+    /*! @brief Returns maximal amount of requests per second. 0 means that rate is not limited. */
+    double         rate() const                            { return m_rate; }
+
+    /*! @brief Sets maximal amount of requests per second. Pass 0 to disable rate limiting. */
+    void           setRate(double requestsPerSecond);
+
+    /*! @brief Returns maximal amount of requests which can be sent at once after period of inactivity. Default is 1. */
+    int            burst() const                           { return m_burst; }
+    void           setBurst(int burst);
+
+    /*! @brief Returns weight of the lane. Weights of Normal and Bulk lanes define how the rate budget is shared
+     *         between them. Default weights are 4 for Normal and 1 for Bulk lane. */
+    int            laneWeight(Priority priority) const     { return m_lanes[priority].weight; }
+    void           setLaneWeight(Priority priority, int weight);
+
+    /*! @brief Returns true if requests of different consumers within one lane are served in round-robin order.
+     *         Enabled by default. */
+    bool           consumerFairness() const                { return m_consumerFairness; }
+    void           setConsumerFairness(bool enabled)       { m_consumerFairness = enabled; }
+
+    /*! @brief Returns priority used for the specified action (e.g. "eth_sendRawTransaction"), if it was not
+     *         specified by RequestScope. */
+    Priority       actionPriority(const QString& action) const { return m_actionPriorities.value(action,Normal); }
+    void           setActionPriority(const QString& action, Priority priority) { m_actionPriorities.insert(action,priority); }
+
+    /*! @brief Sets priority for the endpoint described by E (see QtEtherscan::Endpoints). Other endpoints with the same
+     *         action are not affected. */
+    template<class E>
+    void           setActionPriority(Priority priority)   { setActionPriority(QueryTemplate::endpointKey<E>(),priority); }
+
+    /*! @brief Returns priority used for the query. Priority of the endpoint takes precedence over priority of its
+     *         action. */
+    Priority       queryPriority(const QUrlQuery& query) const;
+
+    /*! @brief Returns maximal amount of requests which can be in progress at the same time. 0 means that amount of
+     *         such requests is not limited. In adaptive mode returns current concurrency window. */
+    int            concurrencyLimit() const;
+
+    /*! @brief Sets maximal amount of requests which can be in progress at the same time. Pass 0 to disable this limit.
+     *         Ignored in adaptive mode. */
+    void           setConcurrencyLimit(int limit);
+
+    /*! @brief Returns amount of slots above concurrency limit (or concurrency window in adaptive mode), which are
+     *         reserved for requests from Interactive lane. Such requests are delayed only by the rate limit even if
+     *         other lanes have saturated concurrency limit. Default is 1. */
+    int            interactiveReserve() const              { return m_interactiveReserve; }
+    void           setInteractiveReserve(int slots);
+
+    /*! @brief Returns amount of requests which are currently in progress. */
+    int            inFlightCount() const                   { return m_inFlight; }
+
+    /*! @brief Returns true if rate and concurrency limit are adjusted automatically. Disabled by default. */
+    bool           isAdaptive() const                      { return m_adaptive; }
+
+    /*! @brief Enables or disables adaptive (AIMD) mode. When enabled and rate was not limited - rate starts from the
+     *         upper of 5 requests per second and minimal rate. */
+    void           setAdaptive(bool enabled);
+
+    /*! @brief Sets bounds within which rate (requests per second) is adjusted in adaptive mode. Default is [1; 50]. */
+    void           setRateBounds(double minimum, double maximum);
+    double         minimumRate() const                     { return m_minimumRate; }
+    double         maximumRate() const                     { return m_maximumRate; }
+
+    /*! @brief Sets bounds within which concurrency window is adjusted in adaptive mode. Default is [1; 16]. */
+    void           setConcurrencyBounds(int minimum, int maximum);
+    int            minimumConcurrency() const              { return m_minimumConcurrency; }
+    int            maximumConcurrency() const              { return m_maximumConcurrency; }
+
+    /*! @brief Returns amount of requests per second, by which rate grows per second of successful requests in adaptive
+     *         mode. Default is 1. */
+    double         additiveIncrease() const                { return m_additiveIncrease; }
+    void           setAdditiveIncrease(double increase)    { m_additiveIncrease = qMax(0.0,increase); }
+
+    /*! @brief Returns factor (0.0-1.0), by which rate and concurrency window are multiplied after failure in adaptive
+     *         mode. Default is 0.5 */
+    double         multiplicativeDecrease() const          { return m_multiplicativeDecrease; }
+    void           setMultiplicativeDecrease(double factor){ m_multiplicativeDecrease = qBound(0.01,factor,1.0); }
+
+    /*! @brief Reports that request was successful. Used in adaptive mode. */
+    void           reportSuccess();
+
+    /*! @brief Reports that request has failed due to rate limit or network error. Used in adaptive mode. */
+    void           reportOverload();
+
+    /*! @brief Returns amount of requests waiting in the specified lane. */
+    int            queuedCount(Priority priority) const    { return m_lanes[priority].count; }
+
+    /*! @brief Returns amount of requests waiting in all lanes. */
+    int            queuedCount() const;
+
+    /*! @brief Places request into the queue. Callback is invoked (possibly from within this method) when request may
+     *         be sent. Returns ticket, which can be used to remove request from the queue. For internal use. */
+    quint64        enqueue(Priority priority, const QString& consumer, const std::function<void()>& callback);
+
+    /*! @brief Removes request, which was not yet granted, from the queue. For internal use. */
+    void           cancel(quint64 ticket);
+
+    /*! @brief Takes token without queueing if it is available right now and nobody is waiting for it. Used for
+     *         optional requests (e.g. hedged duplicates). For internal use. */
+    bool           tryAcquire();
+
+    /*! @brief Notifies scheduler that request, which was granted by enqueue or tryAcquire, is finished. For internal
+     *         use. */
+    void           release();
+
+signals:
+    /*! @brief This signal is emitted when rate or concurrency window were changed in adaptive mode. */
+    void           windowChanged(double rate, int concurrencyLimit);
+
+private slots:
+    void           dispatch();
+
+private:
+    struct Ticket {
+        quint64                 id;
+        std::function<void()>   callback;
+    };
+
+    struct Lane {
+        QHash<QString,QQueue<Ticket>> queues;
+        QList<QString>          consumers;
+        int                     count = 0;
+        int                     weight = 1;
+        int                     currentWeight = 0;
+    };
+
+    struct Location {
+        Priority                priority;
+        QString                 consumer;
+    };
+
+    static constexpr int        LaneCount = 3;
+
+    void           refill();
+    bool           hasFreeSlot(Priority priority) const;
+    bool           takeToken();
+    int            nextLane();
+    Ticket         takeTicket(Lane& lane);
+
+    double                      m_rate;
+    int                         m_burst;
+    double                      m_tokens;
+    QElapsedTimer               m_clock;
+    qint64                      m_lastRefill;
+
+    Lane                        m_lanes[LaneCount];
+    QHash<quint64,Location>     m_locations;
+    QHash<QString,Priority>     m_actionPriorities;
+    bool                        m_consumerFairness;
+    quint64                     m_nextTicket;
+
+    int                         m_concurrencyLimit;
+    int                         m_interactiveReserve;
+    int                         m_inFlight;
+
+    bool                        m_adaptive;
+    double                      m_window;
+    double                      m_minimumRate;
+    double                      m_maximumRate;
+    int                         m_minimumConcurrency;
+    int                         m_maximumConcurrency;
+    double                      m_additiveIncrease;
+    double                      m_multiplicativeDecrease;
+    qint64                      m_lastDecrease;
+
+    QTimer                      m_dispatchTimer;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_REQUESTSCHEDULER_H
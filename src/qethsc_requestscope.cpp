@@ -0,0 +1,99 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_requestscope.h"
+
+#include "qethsc_api.h"
+
+namespace QtEtherscan {
+
+RequestScope::RequestScope(API* api, qint64 timeoutMsec, CancellationToken* token) :
+    RequestScope(api,QDeadlineTimer(timeoutMsec),token)
+{}
+
+RequestScope::RequestScope(API* api, const QDeadlineTimer& deadline, CancellationToken* token) :
+    m_api{api},
+    m_previousContext{api->m_context}
+{
+    Q_ASSERT(m_api);
+
+    if (deadline < m_api->m_context.deadline())
+        m_api->m_context.setDeadline(deadline);
+
+    if (token != nullptr)
+        m_api->m_context.setCancellationToken(token);
+}
+
+RequestScope::RequestScope(API* api, CancellationToken* token) :
+    RequestScope(api,QDeadlineTimer(QDeadlineTimer::Forever),token)
+{}
+
+RequestScope::RequestScope(API* api, RequestScheduler::Priority priority, const QString& consumer) :
+    RequestScope(api,QDeadlineTimer(QDeadlineTimer::Forever),nullptr)
+{
+    setPriority(priority);
+    if (!consumer.isEmpty())
+        setConsumer(consumer);
+}
+
+RequestScope::RequestScope(API* api) :
+    RequestScope(api,QDeadlineTimer(QDeadlineTimer::Forever),nullptr)
+{}
+
+RequestScope::~RequestScope()
+{
+    m_api->m_context = m_previousContext;
+}
+
+void RequestScope::setPriority(RequestScheduler::Priority priority)
+{
+    m_api->m_context.setPriority(priority);
+}
+
+void RequestScope::setConsumer(const QString& consumer)
+{
+    m_api->m_context.setConsumer(consumer);
+}
+
+void RequestScope::setNetwork(API::Network network)
+{
+    m_api->m_context.setNetwork(network);
+}
+
+void RequestScope::setFields(const QStringList& fields)
+{
+    m_api->m_context.setFields(fields);
+}
+
+void RequestScope::setRecordFilter(const RecordFilter& filter)
+{
+    m_api->m_context.setRecordFilter(filter);
+}
+
+void RequestScope::setStringPool(StringPool* pool)
+{
+    m_api->m_context.setStringPool(pool);
+}
+
+} //namespace QtEtherscan
@@ -0,0 +1,116 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_REQUESTSCOPE_H
+#define QT_ETHERSCAN_REQUESTSCOPE_H
+
+#include "./qethsc_api.h"
+#include "./qethsc_requestcontext.h"
+
+namespace QtEtherscan {
+
+/*! @class RequestScope src/qethsc_requestscope.h
+ *  @brief Object of this class applies deadline, cancellation token, priority, consumer name, network, field projection, record
+ *         filter and/or string pool to all requests made by the API object during lifetime of RequestScope object.
+ *  @details Deadline is absolute, so it is shared by all requests made within the scope - including retries and
+ *           paginated requests. Nested scopes can only shorten the deadline of the outer scope. If nested scope
+ *           specifies CancellationToken - it is used instead of the token of outer scope. When RequestScope object is
+ *           destroyed - previous parameters are restored. Global timeout set by API::setRequestTimeout is still applied
+ *           to every single request.
+ *  @code
+ *  {
+ *      QtEtherscan::RequestScope scope(&etherscan, 300);  // Fail fast after 300 ms
+ *      Proxy::BlockNumberResponse head = etherscan.eth_blockNumber();
+ *      if (etherscan.errorCode() == QtEtherscan::API::TimeoutError)
+ *          ...
+ *  }
+ *  @endcode
+ *  Field projection limits decoding of list replies (e.g. API::getListOfNomalTransactions or API::getEventLogs) to the
+ *  specified fields, skipping expensive ones like "input" or "data". Fields, which were not requested, keep their
+ *  default values - so "blockNumber" should be requested if isValid() of the resulting objects is checked.
+ *  @code
+ *  {
+ *      QtEtherscan::RequestScope scope(&etherscan);
+ *      scope.setFields({"blockNumber","hash","from","to","value"});
+ *      QtEtherscan::TransactionList transactions =
+ *          etherscan.getListOfNomalTransactions(address,0,99999999,1,1000,QtEtherscan::Asc);
+ *  }
+ *  @endcode
+ *  RecordFilter drops objects of paged list replies (see Endpoints::Paged), which do not match it, while reply is
+ *  decoded. See RecordFilter for the example. */
+
+class RequestScope
+{
+public:
+    /*! @brief Applies deadline, which will expire in timeoutMsec milliseconds, to all requests within this scope. */
+    RequestScope(API* api, qint64 timeoutMsec, CancellationToken* token = nullptr);
+
+    /*! @brief Applies deadline and optional cancellation token to all requests within this scope. */
+    RequestScope(API* api, const QDeadlineTimer& deadline, CancellationToken* token = nullptr);
+
+    /*! @brief Applies cancellation token to all requests within this scope without changing deadline. */
+    RequestScope(API* api, CancellationToken* token);
+
+    /*! @brief Applies priority to all requests within this scope. If consumer is not empty - requests are also
+     *         accounted to this consumer by RequestScheduler. */
+    RequestScope(API* api, RequestScheduler::Priority priority, const QString& consumer = QString());
+
+    /*! @brief Creates scope with parameters of the outer scope. They can be changed with the setters below. */
+    explicit RequestScope(API* api);
+
+    ~RequestScope();
+
+    /*! @brief Changes priority of the requests made within this scope. */
+    void             setPriority(RequestScheduler::Priority priority);
+
+    /*! @brief Changes consumer name of the requests made within this scope. */
+    void             setConsumer(const QString& consumer);
+
+    /*! @brief Sends all requests within this scope to the specified network, without changing API::etheriumNetwork.
+     *         This allows to use single API object (and therefore single connection pool, RequestScheduler and
+     *         cache) for several networks. */
+    void             setNetwork(API::Network network);
+
+    /*! @brief Decodes only specified fields of list replies received within this scope. Other fields are skipped
+     *         without decoding and keep their default values. Empty list means all fields. */
+    void             setFields(const QStringList& fields);
+
+    /*! @brief Returns only objects matching filter from paged list replies received within this scope. Objects,
+     *         which do not match, are not created at all. Empty filter accepts all objects. */
+    void             setRecordFilter(const RecordFilter& filter);
+
+    /*! @brief Shares repeating values (addresses, token names, block hashes) of list replies received within this
+     *         scope via pool. Pool must outlive this scope. Can be nullptr. */
+    void             setStringPool(StringPool* pool);
+
+private:
+    Q_DISABLE_COPY(RequestScope)
+
+    API*             m_api;
+    RequestContext   m_previousContext;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_REQUESTSCOPE_H
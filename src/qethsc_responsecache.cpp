@@ -0,0 +1,72 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_responsecache.h"
+
+namespace QtEtherscan {
+
+ResponseCache::ResponseCache()
+{
+    m_clock.start();
+}
+
+QString ResponseCache::key(const QUrlQuery& query, const QString& keyNamespace)
+{
+    QUrlQuery result(query);
+    result.removeAllQueryItems(QLatin1String("apikey"));
+    return keyNamespace + QLatin1Char('|') + result.toString(QUrl::FullyEncoded);
+}
+
+ResponseCache::State ResponseCache::lookup(const QString& key, quint32 softTtl, quint32 hardTtl, QJsonObject* response) const
+{
+    auto i = m_entries.constFind(key);
+    if (i == m_entries.constEnd() || i->timestamp < 0)
+        return Missing;
+
+    const qint64 age = m_clock.elapsed() - i->timestamp;
+    if (age >= hardTtl)
+        return Missing;
+
+    if (response != nullptr)
+        *response = i->response;
+
+    return (age < softTtl) ? Fresh : Stale;
+}
+
+void ResponseCache::insert(const QString& key, const QJsonObject& response)
+{
+    Entry& entry = m_entries[key];
+    entry.response = response;
+    entry.timestamp = m_clock.elapsed();
+    entry.refreshing = false;
+}
+
+void ResponseCache::setRefreshing(const QString& key, bool refreshing)
+{
+    auto i = m_entries.find(key);
+    if (i != m_entries.end())
+        i->refreshing = refreshing;
+}
+
+} //namespace QtEtherscan
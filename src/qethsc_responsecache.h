@@ -0,0 +1,81 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_RESPONSECACHE_H
+#define QT_ETHERSCAN_RESPONSECACHE_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonObject>
+#include <QString>
+#include <QUrlQuery>
+
+namespace QtEtherscan {
+
+/*! @class ResponseCache src/qethsc_responsecache.h
+ *  @brief This class stores replies from Etherscan API servers, which are cached according to CachePolicy. For
+ *         internal use only. */
+
+class ResponseCache
+{
+public:
+    /*! @brief This enum describes state of the cached reply. */
+    enum State {
+        Missing,   /*!< @brief There is no reply or it is older than hard TTL */
+        Fresh,     /*!< @brief Reply is younger than soft TTL */
+        Stale      /*!< @brief Reply is older than soft TTL, but younger than hard TTL */
+    };
+
+    ResponseCache();
+
+    /*! @brief Returns cache key for the query. API key is not a part of the cache key. Keys with different namespaces
+     *         (e.g. chain ids) never match. */
+    static QString key(const QUrlQuery& query, const QString& keyNamespace = QString());
+
+    /*! @brief Looks for the cached reply. If reply is Fresh or Stale - it is written to response. */
+    State          lookup(const QString& key, quint32 softTtl, quint32 hardTtl, QJsonObject* response) const;
+
+    /*! @brief Stores reply in the cache. */
+    void           insert(const QString& key, const QJsonObject& response);
+
+    /*! @brief Returns true if background request refreshing this entry is in progress. */
+    bool           isRefreshing(const QString& key) const  { return m_entries.value(key).refreshing; }
+    void           setRefreshing(const QString& key, bool refreshing);
+
+    void           clear()                                 { m_entries.clear(); }
+
+private:
+    struct Entry {
+        QJsonObject  response;
+        qint64       timestamp = -1;
+        bool         refreshing = false;
+    };
+
+    QHash<QString,Entry>   m_entries;
+    QElapsedTimer          m_clock;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_RESPONSECACHE_H
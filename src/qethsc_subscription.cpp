@@ -0,0 +1,142 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_subscription.h"
+
+#include <utility>
+
+#include "qethsc_api.h"
+#include "qethsc_pendingrequest.h"
+
+namespace QtEtherscan {
+
+void Subscription::setInterval(quint32 msec)
+{
+    m_interval = msec;
+    if (!m_poller.isNull())
+        m_poller->updateInterval();
+}
+
+SubscriptionPoller::SubscriptionPoller(API* api, const QString& key, const QUrlQuery& query, const RequestContext& context) :
+    QObject{api},
+    m_api{api},
+    m_key{key},
+    m_query{query},
+    m_context{context}
+{
+    connect(&m_timer, &QTimer::timeout, this, &SubscriptionPoller::poll);
+}
+
+void SubscriptionPoller::addSubscription(Subscription* subscription)
+{
+    subscription->m_poller = this;
+    m_subscriptions.append(subscription);
+    connect(subscription, &QObject::destroyed, this, &SubscriptionPoller::removeSubscription);
+
+    // New subscriber to the already polled topic receives current result without waiting for the next poll.
+    if (!m_lastResponse.isEmpty()) {
+        subscription->m_response = m_lastResponse;
+        QPointer<Subscription> guard(subscription);
+        QMetaObject::invokeMethod(subscription, [guard]() {
+            if (!guard.isNull())
+                emit guard->resultChanged(guard->result());
+        }, Qt::QueuedConnection);
+    }
+
+    const bool firstSubscription = !m_timer.isActive();
+    updateInterval();
+    if (firstSubscription)
+        poll();
+}
+
+void SubscriptionPoller::updateInterval()
+{
+    if (m_subscriptions.isEmpty())
+        return;
+
+    quint32 interval = m_subscriptions.first()->interval();
+    for (const Subscription* subscription : std::as_const(m_subscriptions))
+        interval = qMin(interval,subscription->interval());
+
+    if (!m_timer.isActive() || m_timer.interval() != static_cast<int>(interval))
+        m_timer.start(static_cast<int>(interval));
+}
+
+void SubscriptionPoller::removeSubscription(QObject* subscription)
+{
+    // Subscription is already partially destroyed here, only its address is used.
+    m_subscriptions.removeAll(static_cast<Subscription*>(subscription));
+    if (!m_subscriptions.isEmpty()) {
+        updateInterval();
+        return;
+    }
+
+    // Topic without subscribers is not polled anymore. Next subscription will create new poller.
+    m_api->m_pollers.remove(m_key);
+    m_timer.stop();
+    if (!m_pending.isNull())
+        m_pending->abort();
+    deleteLater();
+}
+
+void SubscriptionPoller::poll()
+{
+    // Next poll is skipped while previous one is still in progress.
+    if (!m_pending.isNull())
+        return;
+
+    QPointer<SubscriptionPoller> guard(this);
+    m_pending = m_api->makeAsyncApiCall(m_query,m_context,[guard](const QJsonObject& response) {
+        if (!guard.isNull())
+            guard->onReply(response);
+    });
+}
+
+void SubscriptionPoller::onReply(const QJsonObject& response)
+{
+    // Failed polls keep the last known result.
+    if (!API::isSuccessfulResponse(response))
+        return;
+
+    if (!m_lastResponse.isEmpty() && m_lastResponse.value("result") == response.value("result"))
+        return;
+
+    m_lastResponse = response;
+    const QJsonValue result = response.value("result");
+
+    // Slots connected to resultChanged may delete other subscriptions.
+    QList<QPointer<Subscription>> subscriptions;
+    for (Subscription* subscription : std::as_const(m_subscriptions))
+        subscriptions.append(subscription);
+
+    for (const QPointer<Subscription>& subscription : std::as_const(subscriptions)) {
+        if (subscription.isNull())
+            continue;
+
+        subscription->m_response = response;
+        emit subscription->resultChanged(result);
+    }
+}
+
+} //namespace QtEtherscan
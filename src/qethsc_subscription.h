@@ -0,0 +1,129 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_SUBSCRIPTION_H
+#define QT_ETHERSCAN_SUBSCRIPTION_H
+
+#include <QObject>
+
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+#include <QPointer>
+#include <QTimer>
+#include <QUrlQuery>
+
+#include "./qethsc_requestcontext.h"
+
+namespace QtEtherscan {
+
+class API;
+class PendingRequest;
+class SubscriptionPoller;
+
+/*! @class Subscription src/qethsc_subscription.h
+ *  @brief Object of this class receives results of periodical polling of one API method (topic).
+ *  @details Subscriptions are created by API::subscribe methods (e.g. API::subscribeGasOracle). All subscriptions to
+ *           the same topic made through one API object share one poller, which makes requests with the shortest
+ *           interval requested by its subscribers. Signal Subscription::resultChanged is emitted only when result of
+ *           the polled method changes. Polling stops when all subscriptions to the topic are deleted.
+ *
+ *  @code
+ *  QtEtherscan::Subscription* gas = etherscan.subscribeGasOracle(5000,this);
+ *  connect(gas, &QtEtherscan::Subscription::resultChanged, this, [gas]() {
+ *      qDebug() << QtEtherscan::GasOracle(gas->result());
+ *  });
+ *  @endcode */
+
+class Subscription : public QObject
+{
+    Q_OBJECT
+public:
+    ~Subscription() {}
+
+    /*! @brief Returns desired polling interval (in mseconds) of this subscription. */
+    quint32        interval() const                        { return m_interval; }
+
+    /*! @brief Changes desired polling interval of this subscription. */
+    void           setInterval(quint32 msec);
+
+    /*! @brief Returns true if at least one successful reply was received. */
+    bool           hasResult() const                       { return !m_response.isEmpty(); }
+
+    /*! @brief Returns "result" field of the last successful reply. Can be used to construct objects of the types
+     *         returned by etherscan API methods (e.g. GasOracle, EtherPrice or EtherBalance). */
+    QJsonValue     result() const                          { return m_response.value("result"); }
+
+    /*! @brief Returns whole last successful reply. Can be used to construct objects of the types returned by proxy
+     *         methods (e.g. Proxy::BlockNumberResponse). */
+    QJsonObject    response() const                        { return m_response; }
+
+signals:
+    /*! @brief This signal is emitted when result of the polled method changes. It is also emitted shortly after
+     *         subscribing to the topic, which already has a result. */
+    void           resultChanged(const QJsonValue& result);
+
+private:
+    friend class SubscriptionPoller;
+
+    Subscription(quint32 interval, QObject* parent) :
+        QObject{parent}, m_interval{interval} {}
+
+    quint32                      m_interval;
+    QJsonObject                  m_response;
+    QPointer<SubscriptionPoller> m_poller;
+};
+
+/*! @class SubscriptionPoller src/qethsc_subscription.h
+ *  @brief Object of this class polls one topic and delivers changed results to all its subscriptions. For internal
+ *         use only, created by API::subscribe. */
+
+class SubscriptionPoller : public QObject
+{
+    Q_OBJECT
+public:
+    SubscriptionPoller(API* api, const QString& key, const QUrlQuery& query, const RequestContext& context);
+    ~SubscriptionPoller() {}
+
+    void           addSubscription(Subscription* subscription);
+    void           updateInterval();
+
+private:
+    void           poll();
+    void           onReply(const QJsonObject& response);
+    void           removeSubscription(QObject* subscription);
+
+    API*                         m_api;
+    QString                      m_key;
+    QUrlQuery                    m_query;
+    RequestContext               m_context;
+    QList<Subscription*>         m_subscriptions;
+    QTimer                       m_timer;
+    QPointer<PendingRequest>     m_pending;
+    QJsonObject                  m_lastResponse;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_SUBSCRIPTION_H
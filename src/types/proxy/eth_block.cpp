@@ -25,6 +25,9 @@
 #include "eth_block.h"
 
 #include <QJsonArray>
+#include <QVector>
+
+#include "../../qethsc_paralleldecoding.h"
 
 namespace QtEtherscan {
 
@@ -59,18 +62,40 @@ Block::Block(const QJsonObject& jsonObject) :
     m_timestamp         {jsonObject.value("timestamp").toString(InvalidTimestampString).toLongLong(nullptr,0)     }
 {
     // Transactions
-    QJsonArray transactionsArray = jsonObject.value("transactions").toArray();
-    for (auto i = transactionsArray.constBegin(); i != transactionsArray.constEnd(); i++) {
-        if (i->isString()) {
-            m_transactionHashList.append(i->toString());
-        } else if (i->isObject()) {
-            Transaction tr(i->toObject());
+    const QJsonArray transactionsArray = jsonObject.value("transactions").toArray();
+    const bool fullTransactions = !transactionsArray.isEmpty() && transactionsArray.first().isObject();
+    m_transactionHashList.reserve(transactionsArray.size());
+    if (fullTransactions)
+        m_transactionList.reserve(transactionsArray.size());
+
+    // Full transaction objects of large blocks are decoded in parallel, then collected in the original order
+    QVector<Transaction> decodedTransactions;
+    if (fullTransactions && ParallelDecoding::isEnabledFor(transactionsArray.size())) {
+        decodedTransactions.resize(transactionsArray.size());
+        Transaction* decodedData = decodedTransactions.data();
+        ParallelDecoding::forEachChunk(transactionsArray.size(),[&transactionsArray,decodedData](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                const QJsonValue transactionValue = transactionsArray.at(i);
+                if (transactionValue.isObject())
+                    decodedData[i] = Transaction(transactionValue.toObject());
+            }
+        });
+    }
+
+    for (int i = 0; i < transactionsArray.size(); i++) {
+        const QJsonValue transactionValue = transactionsArray.at(i);
+        if (transactionValue.isString()) {
+            m_transactionHashList.append(transactionValue.toString());
+        } else if (transactionValue.isObject()) {
+            Transaction tr = decodedTransactions.isEmpty() ? Transaction(transactionValue.toObject())
+                                                           : std::move(decodedTransactions[i]);
             m_transactionHashList.append(tr.hash());
             m_transactionList.append(std::move(tr));
         }
     }
 
     QJsonArray unclesArray = jsonObject.value("uncles").toArray();
+    m_uncles.reserve(unclesArray.size());
     for (const QJsonValue& uncleValue : unclesArray)
         m_uncles.append(uncleValue.toString());
 }
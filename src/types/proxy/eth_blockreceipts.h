@@ -0,0 +1,84 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_ETH_BLOCKRECEIPTS_H
+#define QT_ETHERSCAN_ETH_BLOCKRECEIPTS_H
+
+#include "./eth_block.h"
+#include "./eth_transactionreceipt.h"
+
+namespace QtEtherscan {
+
+namespace Proxy {
+
+/*! @class BlockReceipts src/types/proxy/eth_blockreceipts.h
+ *  @brief Object of this type contains block together with receipts of all its transactions. It is returned by
+ *         BlockReceiptsFetcher.
+ *  @details Receipts are stored in the same order as Proxy::Block::transactionHashList. */
+
+class BlockReceipts
+{
+public:
+    /*! @brief Default constructor. Constructs invalid Proxy::BlockReceipts object. */
+    BlockReceipts() {}
+    BlockReceipts(const Block& block, const TransactionReceiptList& receipts) :
+        m_block(block), m_receipts(receipts) {}
+
+    /*! @brief Returns true if block is valid and there is a valid receipt for each of its transactions. */
+    bool isValid() const                              {
+        if (!m_block.isValid() || m_receipts.size() != m_block.transactionHashList().size())
+            return false;
+
+        for (const TransactionReceipt& receipt : m_receipts) {
+            if (!receipt.isValid())
+                return false;
+        }
+        return true;
+    }
+
+    /*! @brief Returns the block. */
+    Block block() const                               { return m_block; }
+
+    /*! @brief Returns list of transaction receipts. */
+    TransactionReceiptList receipts() const           { return m_receipts; }
+
+private:
+    Block                  m_block;
+    TransactionReceiptList m_receipts;
+};
+
+inline QDebug operator<< (QDebug dbg, const BlockReceipts& blockReceipts)
+{
+    dbg.nospace() << qUtf8Printable(QString("Proxy::BlockReceipts(numberString=%1; receipts=%2)")
+                                    .arg(blockReceipts.block().numberString())
+                                    .arg(blockReceipts.receipts().size()));
+
+    return dbg.maybeSpace();
+}
+
+} // namespace Proxy
+
+} // namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_ETH_BLOCKRECEIPTS_H
@@ -29,6 +29,8 @@
 #include <QJsonValue>
 #include <QString>
 
+#include <utility>
+
 namespace QtEtherscan {
 
 namespace Proxy {
@@ -150,10 +152,16 @@ public:
 
     /*! @brief Returns object of type C, which was returned by method from "proxy" etherscan module.
     *  @details Object of this type is a representation of JSON field result from etherscan.io reply. */
-    C         result() const           { return m_result; }
+    const C&  result() const &         { return m_result; }
+    C         result() &&              { return std::move(m_result); }
 
-    /*! @brief Cast operator, which is provided for convenience. */
-    operator C() const                 { return m_result; }
+    /*! @brief Moves object of type C out of this response. After this call result() returns default constructed
+     *         object, so large objects (e.g. Proxy::Block with transactions) are not copied. */
+    C         takeResult()             { C result(std::move(m_result)); m_result = C(); return result; }
+
+    /*! @brief Cast operator, which is provided for convenience. Temporary responses give away their result. */
+    operator const C&() const &        { return m_result; }
+    operator C() &&                    { return std::move(m_result); }
 
 private:
     C m_result;
@@ -138,6 +138,12 @@ inline QDebug operator<< (QDebug dbg, const TransactionReceipt& transactionRecei
     return dbg.maybeSpace();
 }
 
+/*! @typedef TransactionReceiptList src/types/proxy/eth_transactionreceipt.h
+ *  @brief This is a list of Proxy::TransactionReceipt objects. Nothing more than a QList with some extra constructors
+ *         (JsonObjectsList). */
+
+typedef JsonObjectsList<Proxy::TransactionReceipt> TransactionReceiptList;
+
 /*! @class TransactionReceiptResponse src/types/proxy/eth_transactionreceipt.h
  *  @brief Object of this type is returned by API::eth_getTransactionReceipt method. Data about transaction receipt can
  *         be obtained using TransactionReceiptResponse::transactionReceipt method.
@@ -0,0 +1,850 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_columnarlists.h"
+
+namespace QtEtherscan {
+
+/*
+ **********************************************************************************************************************
+ *
+ * TransactionColumns
+ *
+ */
+
+TransactionColumns::TransactionColumns(const TransactionList& list) :
+    m_count{0}
+{
+    reserve(list.count());
+    for (const Transaction& row : list)
+        append(row);
+}
+
+void TransactionColumns::reserve(int rows)
+{
+    m_blockNumber.reserve(rows);
+    m_timeStamp.reserve(rows);
+    m_hash.reserve(rows);
+    m_nonce.reserve(rows);
+    m_blockHash.reserve(rows);
+    m_transactionIndex.reserve(rows);
+    m_from.reserve(rows);
+    m_to.reserve(rows);
+    m_valueString.reserve(rows);
+    m_valueWei.reserve(rows);
+    m_gas.reserve(rows);
+    m_gasPrice.reserve(rows);
+    m_isErrorString.reserve(rows);
+    m_txreceiptStatusString.reserve(rows);
+    m_input.reserve(rows);
+    m_contractAddress.reserve(rows);
+    m_cumulativeGasUsed.reserve(rows);
+    m_gasUsed.reserve(rows);
+    m_confirmations.reserve(rows);
+    m_methodIdString.reserve(rows);
+    m_functionName.reserve(rows);
+}
+
+void TransactionColumns::append(const Transaction& row)
+{
+    m_blockNumber.append(row.m_blockNumber);
+    m_timeStamp.append(row.m_timeStamp);
+    m_hash.append(row.m_hash);
+    m_nonce.append(row.m_nonce);
+    m_blockHash.append(row.m_blockHash);
+    m_transactionIndex.append(row.m_transactionIndex);
+    m_from.append(row.m_from);
+    m_to.append(row.m_to);
+    m_valueString.append(row.m_value.weiString());
+    m_valueWei.append(row.m_value.wei());
+    m_gas.append(row.m_gas);
+    m_gasPrice.append(row.m_gasPrice);
+    m_isErrorString.append(row.m_isErrorString);
+    m_txreceiptStatusString.append(row.m_txreceiptStatusString);
+    m_input.append(row.m_input);
+    m_contractAddress.append(row.m_contractAddress);
+    m_cumulativeGasUsed.append(row.m_cumulativeGasUsed);
+    m_gasUsed.append(row.m_gasUsed);
+    m_confirmations.append(row.m_confirmations);
+    m_methodIdString.append(row.m_methodIdString);
+    m_functionName.append(row.m_functionName);
+    m_count++;
+}
+
+void TransactionColumns::append(const FlatJsonRecord& record)
+{
+    enum Field {
+        BlockNumberField = 0,
+        TimeStampField,
+        HashField,
+        NonceField,
+        BlockHashField,
+        TransactionIndexField,
+        FromField,
+        ToField,
+        ValueStringField,
+        GasField,
+        GasPriceField,
+        IsErrorStringField,
+        TxreceiptStatusStringField,
+        InputField,
+        ContractAddressField,
+        CumulativeGasUsedField,
+        GasUsedField,
+        ConfirmationsField,
+        MethodIdStringField,
+        FunctionNameField,
+        FieldCount
+    };
+
+    const FlatJsonField* fields[FieldCount] = {};
+    for (const FlatJsonField& field : record) {
+        if (field.isArray())
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                fields[BlockNumberField] = &field;
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                fields[TimeStampField] = &field;
+            break;
+        case flatJsonKeyHash("hash"):
+            if (field.key() == QLatin1String("hash"))
+                fields[HashField] = &field;
+            break;
+        case flatJsonKeyHash("nonce"):
+            if (field.key() == QLatin1String("nonce"))
+                fields[NonceField] = &field;
+            break;
+        case flatJsonKeyHash("blockHash"):
+            if (field.key() == QLatin1String("blockHash"))
+                fields[BlockHashField] = &field;
+            break;
+        case flatJsonKeyHash("transactionIndex"):
+            if (field.key() == QLatin1String("transactionIndex"))
+                fields[TransactionIndexField] = &field;
+            break;
+        case flatJsonKeyHash("from"):
+            if (field.key() == QLatin1String("from"))
+                fields[FromField] = &field;
+            break;
+        case flatJsonKeyHash("to"):
+            if (field.key() == QLatin1String("to"))
+                fields[ToField] = &field;
+            break;
+        case flatJsonKeyHash("value"):
+            if (field.key() == QLatin1String("value"))
+                fields[ValueStringField] = &field;
+            break;
+        case flatJsonKeyHash("gas"):
+            if (field.key() == QLatin1String("gas"))
+                fields[GasField] = &field;
+            break;
+        case flatJsonKeyHash("gasPrice"):
+            if (field.key() == QLatin1String("gasPrice"))
+                fields[GasPriceField] = &field;
+            break;
+        case flatJsonKeyHash("isError"):
+            if (field.key() == QLatin1String("isError"))
+                fields[IsErrorStringField] = &field;
+            break;
+        case flatJsonKeyHash("txreceipt_status"):
+            if (field.key() == QLatin1String("txreceipt_status"))
+                fields[TxreceiptStatusStringField] = &field;
+            break;
+        case flatJsonKeyHash("input"):
+            if (field.key() == QLatin1String("input"))
+                fields[InputField] = &field;
+            break;
+        case flatJsonKeyHash("contractAddress"):
+            if (field.key() == QLatin1String("contractAddress"))
+                fields[ContractAddressField] = &field;
+            break;
+        case flatJsonKeyHash("cumulativeGasUsed"):
+            if (field.key() == QLatin1String("cumulativeGasUsed"))
+                fields[CumulativeGasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                fields[GasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("confirmations"):
+            if (field.key() == QLatin1String("confirmations"))
+                fields[ConfirmationsField] = &field;
+            break;
+        case flatJsonKeyHash("methodId"):
+            if (field.key() == QLatin1String("methodId"))
+                fields[MethodIdStringField] = &field;
+            break;
+        case flatJsonKeyHash("functionName"):
+            if (field.key() == QLatin1String("functionName"))
+                fields[FunctionNameField] = &field;
+            break;
+        }
+    }
+
+    m_blockNumber.append(fields[BlockNumberField] ? fields[BlockNumberField]->toInt() : InvalidBlockNumber);
+    m_timeStamp.append(fields[TimeStampField] ? fields[TimeStampField]->toLongLong() : InvalidTimestamp);
+    m_hash.append(fields[HashField]);
+    m_nonce.append(fields[NonceField] ? fields[NonceField]->toULongLong() : 0);
+    m_blockHash.append(fields[BlockHashField]);
+    m_transactionIndex.append(fields[TransactionIndexField] ? fields[TransactionIndexField]->toUInt() : 0);
+    m_from.append(fields[FromField]);
+    m_to.append(fields[ToField]);
+    m_valueString.append(fields[ValueStringField]);
+    m_valueWei.append(fields[ValueStringField] ? fields[ValueStringField]->toDouble() : 0);
+    m_gas.append(fields[GasField] ? fields[GasField]->toULongLong() : 0);
+    m_gasPrice.append(fields[GasPriceField] ? fields[GasPriceField]->toULongLong() : 0);
+    m_isErrorString.append(fields[IsErrorStringField]);
+    m_txreceiptStatusString.append(fields[TxreceiptStatusStringField]);
+    m_input.append(fields[InputField]);
+    m_contractAddress.append(fields[ContractAddressField]);
+    m_cumulativeGasUsed.append(fields[CumulativeGasUsedField] ? fields[CumulativeGasUsedField]->toULongLong() : 0);
+    m_gasUsed.append(fields[GasUsedField] ? fields[GasUsedField]->toULongLong() : 0);
+    m_confirmations.append(fields[ConfirmationsField] ? fields[ConfirmationsField]->toULongLong() : 0);
+    m_methodIdString.append(fields[MethodIdStringField]);
+    m_functionName.append(fields[FunctionNameField]);
+    m_count++;
+}
+
+Transaction TransactionColumns::at(int row) const
+{
+    Transaction result;
+    result.m_blockNumber = m_blockNumber.at(row);
+    result.m_timeStamp = m_timeStamp.at(row);
+    result.m_hash = m_hash.at(row);
+    result.m_nonce = m_nonce.at(row);
+    result.m_blockHash = m_blockHash.at(row);
+    result.m_transactionIndex = m_transactionIndex.at(row);
+    result.m_from = m_from.at(row);
+    result.m_to = m_to.at(row);
+    result.m_value = Ether(m_valueString.at(row));
+    result.m_gas = m_gas.at(row);
+    result.m_gasPrice = m_gasPrice.at(row);
+    result.m_isErrorString = m_isErrorString.at(row);
+    result.m_txreceiptStatusString = m_txreceiptStatusString.at(row);
+    result.m_input = m_input.at(row);
+    result.m_contractAddress = m_contractAddress.at(row);
+    result.m_cumulativeGasUsed = m_cumulativeGasUsed.at(row);
+    result.m_gasUsed = m_gasUsed.at(row);
+    result.m_confirmations = m_confirmations.at(row);
+    result.m_methodIdString = m_methodIdString.at(row);
+    result.m_functionName = m_functionName.at(row);
+    return result;
+}
+
+TransactionList TransactionColumns::toList() const
+{
+    TransactionList result;
+    result.reserve(m_count);
+    for (int row = 0; row < m_count; row++)
+        result.append(at(row));
+    return result;
+}
+
+/*
+ **********************************************************************************************************************
+ *
+ * InternalTransactionColumns
+ *
+ */
+
+InternalTransactionColumns::InternalTransactionColumns(const InternalTransactionList& list) :
+    m_count{0}
+{
+    reserve(list.count());
+    for (const InternalTransaction& row : list)
+        append(row);
+}
+
+void InternalTransactionColumns::reserve(int rows)
+{
+    m_blockNumber.reserve(rows);
+    m_timeStamp.reserve(rows);
+    m_hash.reserve(rows);
+    m_from.reserve(rows);
+    m_to.reserve(rows);
+    m_valueString.reserve(rows);
+    m_valueWei.reserve(rows);
+    m_contractAddress.reserve(rows);
+    m_input.reserve(rows);
+    m_typeString.reserve(rows);
+    m_gas.reserve(rows);
+    m_gasUsed.reserve(rows);
+    m_traceIdString.reserve(rows);
+    m_isErrorString.reserve(rows);
+    m_errCodeString.reserve(rows);
+}
+
+void InternalTransactionColumns::append(const InternalTransaction& row)
+{
+    m_blockNumber.append(row.m_blockNumber);
+    m_timeStamp.append(row.m_timeStamp);
+    m_hash.append(row.m_hash);
+    m_from.append(row.m_from);
+    m_to.append(row.m_to);
+    m_valueString.append(row.m_value.weiString());
+    m_valueWei.append(row.m_value.wei());
+    m_contractAddress.append(row.m_contractAddress);
+    m_input.append(row.m_input);
+    m_typeString.append(row.m_typeString);
+    m_gas.append(row.m_gas);
+    m_gasUsed.append(row.m_gasUsed);
+    m_traceIdString.append(row.m_traceIdString);
+    m_isErrorString.append(row.m_isErrorString);
+    m_errCodeString.append(row.m_errCodeString);
+    m_count++;
+}
+
+void InternalTransactionColumns::append(const FlatJsonRecord& record)
+{
+    enum Field {
+        BlockNumberField = 0,
+        TimeStampField,
+        HashField,
+        FromField,
+        ToField,
+        ValueStringField,
+        ContractAddressField,
+        InputField,
+        TypeStringField,
+        GasField,
+        GasUsedField,
+        TraceIdStringField,
+        IsErrorStringField,
+        ErrCodeStringField,
+        FieldCount
+    };
+
+    const FlatJsonField* fields[FieldCount] = {};
+    for (const FlatJsonField& field : record) {
+        if (field.isArray())
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                fields[BlockNumberField] = &field;
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                fields[TimeStampField] = &field;
+            break;
+        case flatJsonKeyHash("hash"):
+            if (field.key() == QLatin1String("hash"))
+                fields[HashField] = &field;
+            break;
+        case flatJsonKeyHash("from"):
+            if (field.key() == QLatin1String("from"))
+                fields[FromField] = &field;
+            break;
+        case flatJsonKeyHash("to"):
+            if (field.key() == QLatin1String("to"))
+                fields[ToField] = &field;
+            break;
+        case flatJsonKeyHash("value"):
+            if (field.key() == QLatin1String("value"))
+                fields[ValueStringField] = &field;
+            break;
+        case flatJsonKeyHash("contractAddress"):
+            if (field.key() == QLatin1String("contractAddress"))
+                fields[ContractAddressField] = &field;
+            break;
+        case flatJsonKeyHash("input"):
+            if (field.key() == QLatin1String("input"))
+                fields[InputField] = &field;
+            break;
+        case flatJsonKeyHash("type"):
+            if (field.key() == QLatin1String("type"))
+                fields[TypeStringField] = &field;
+            break;
+        case flatJsonKeyHash("gas"):
+            if (field.key() == QLatin1String("gas"))
+                fields[GasField] = &field;
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                fields[GasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("traceId"):
+            if (field.key() == QLatin1String("traceId"))
+                fields[TraceIdStringField] = &field;
+            break;
+        case flatJsonKeyHash("isError"):
+            if (field.key() == QLatin1String("isError"))
+                fields[IsErrorStringField] = &field;
+            break;
+        case flatJsonKeyHash("errCode"):
+            if (field.key() == QLatin1String("errCode"))
+                fields[ErrCodeStringField] = &field;
+            break;
+        }
+    }
+
+    m_blockNumber.append(fields[BlockNumberField] ? fields[BlockNumberField]->toInt() : InvalidBlockNumber);
+    m_timeStamp.append(fields[TimeStampField] ? fields[TimeStampField]->toLongLong() : InvalidTimestamp);
+    m_hash.append(fields[HashField]);
+    m_from.append(fields[FromField]);
+    m_to.append(fields[ToField]);
+    m_valueString.append(fields[ValueStringField]);
+    m_valueWei.append(fields[ValueStringField] ? fields[ValueStringField]->toDouble() : 0);
+    m_contractAddress.append(fields[ContractAddressField]);
+    m_input.append(fields[InputField]);
+    m_typeString.append(fields[TypeStringField]);
+    m_gas.append(fields[GasField] ? fields[GasField]->toULongLong() : 0);
+    m_gasUsed.append(fields[GasUsedField] ? fields[GasUsedField]->toULongLong() : 0);
+    m_traceIdString.append(fields[TraceIdStringField]);
+    m_isErrorString.append(fields[IsErrorStringField]);
+    m_errCodeString.append(fields[ErrCodeStringField]);
+    m_count++;
+}
+
+InternalTransaction InternalTransactionColumns::at(int row) const
+{
+    InternalTransaction result;
+    result.m_blockNumber = m_blockNumber.at(row);
+    result.m_timeStamp = m_timeStamp.at(row);
+    result.m_hash = m_hash.at(row);
+    result.m_from = m_from.at(row);
+    result.m_to = m_to.at(row);
+    result.m_value = Ether(m_valueString.at(row));
+    result.m_contractAddress = m_contractAddress.at(row);
+    result.m_input = m_input.at(row);
+    result.m_typeString = m_typeString.at(row);
+    result.m_gas = m_gas.at(row);
+    result.m_gasUsed = m_gasUsed.at(row);
+    result.m_traceIdString = m_traceIdString.at(row);
+    result.m_isErrorString = m_isErrorString.at(row);
+    result.m_errCodeString = m_errCodeString.at(row);
+    return result;
+}
+
+InternalTransactionList InternalTransactionColumns::toList() const
+{
+    InternalTransactionList result;
+    result.reserve(m_count);
+    for (int row = 0; row < m_count; row++)
+        result.append(at(row));
+    return result;
+}
+
+/*
+ **********************************************************************************************************************
+ *
+ * ERC20TokenTransferEventColumns
+ *
+ */
+
+ERC20TokenTransferEventColumns::ERC20TokenTransferEventColumns(const ERC20TokenTransferEventList& list) :
+    m_count{0}
+{
+    reserve(list.count());
+    for (const ERC20TokenTransferEvent& row : list)
+        append(row);
+}
+
+void ERC20TokenTransferEventColumns::reserve(int rows)
+{
+    m_blockNumber.reserve(rows);
+    m_timeStamp.reserve(rows);
+    m_hash.reserve(rows);
+    m_nonce.reserve(rows);
+    m_blockHash.reserve(rows);
+    m_from.reserve(rows);
+    m_contractAddress.reserve(rows);
+    m_to.reserve(rows);
+    m_value.reserve(rows);
+    m_tokenName.reserve(rows);
+    m_tokenSymbol.reserve(rows);
+    m_tokenDecimal.reserve(rows);
+    m_transactionIndex.reserve(rows);
+    m_gas.reserve(rows);
+    m_gasPrice.reserve(rows);
+    m_gasUsed.reserve(rows);
+    m_cumulativeGasUsed.reserve(rows);
+    m_input.reserve(rows);
+    m_confirmations.reserve(rows);
+}
+
+void ERC20TokenTransferEventColumns::append(const ERC20TokenTransferEvent& row)
+{
+    m_blockNumber.append(row.m_blockNumber);
+    m_timeStamp.append(row.m_timeStamp);
+    m_hash.append(row.m_hash);
+    m_nonce.append(row.m_nonce);
+    m_blockHash.append(row.m_blockHash);
+    m_from.append(row.m_from);
+    m_contractAddress.append(row.m_contractAddress);
+    m_to.append(row.m_to);
+    m_value.append(row.m_value);
+    m_tokenName.append(row.m_tokenName);
+    m_tokenSymbol.append(row.m_tokenSymbol);
+    m_tokenDecimal.append(row.m_tokenDecimal);
+    m_transactionIndex.append(row.m_transactionIndex);
+    m_gas.append(row.m_gas);
+    m_gasPrice.append(row.m_gasPrice);
+    m_gasUsed.append(row.m_gasUsed);
+    m_cumulativeGasUsed.append(row.m_cumulativeGasUsed);
+    m_input.append(row.m_input);
+    m_confirmations.append(row.m_confirmations);
+    m_count++;
+}
+
+void ERC20TokenTransferEventColumns::append(const FlatJsonRecord& record)
+{
+    enum Field {
+        BlockNumberField = 0,
+        TimeStampField,
+        HashField,
+        NonceField,
+        BlockHashField,
+        FromField,
+        ContractAddressField,
+        ToField,
+        ValueStringField,
+        TokenNameField,
+        TokenSymbolField,
+        TokenDecimalField,
+        TransactionIndexField,
+        GasField,
+        GasPriceField,
+        GasUsedField,
+        CumulativeGasUsedField,
+        InputField,
+        ConfirmationsField,
+        FieldCount
+    };
+
+    const FlatJsonField* fields[FieldCount] = {};
+    for (const FlatJsonField& field : record) {
+        if (field.isArray())
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                fields[BlockNumberField] = &field;
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                fields[TimeStampField] = &field;
+            break;
+        case flatJsonKeyHash("hash"):
+            if (field.key() == QLatin1String("hash"))
+                fields[HashField] = &field;
+            break;
+        case flatJsonKeyHash("nonce"):
+            if (field.key() == QLatin1String("nonce"))
+                fields[NonceField] = &field;
+            break;
+        case flatJsonKeyHash("blockHash"):
+            if (field.key() == QLatin1String("blockHash"))
+                fields[BlockHashField] = &field;
+            break;
+        case flatJsonKeyHash("from"):
+            if (field.key() == QLatin1String("from"))
+                fields[FromField] = &field;
+            break;
+        case flatJsonKeyHash("contractAddress"):
+            if (field.key() == QLatin1String("contractAddress"))
+                fields[ContractAddressField] = &field;
+            break;
+        case flatJsonKeyHash("to"):
+            if (field.key() == QLatin1String("to"))
+                fields[ToField] = &field;
+            break;
+        case flatJsonKeyHash("value"):
+            if (field.key() == QLatin1String("value"))
+                fields[ValueStringField] = &field;
+            break;
+        case flatJsonKeyHash("tokenName"):
+            if (field.key() == QLatin1String("tokenName"))
+                fields[TokenNameField] = &field;
+            break;
+        case flatJsonKeyHash("tokenSymbol"):
+            if (field.key() == QLatin1String("tokenSymbol"))
+                fields[TokenSymbolField] = &field;
+            break;
+        case flatJsonKeyHash("tokenDecimal"):
+            if (field.key() == QLatin1String("tokenDecimal"))
+                fields[TokenDecimalField] = &field;
+            break;
+        case flatJsonKeyHash("transactionIndex"):
+            if (field.key() == QLatin1String("transactionIndex"))
+                fields[TransactionIndexField] = &field;
+            break;
+        case flatJsonKeyHash("gas"):
+            if (field.key() == QLatin1String("gas"))
+                fields[GasField] = &field;
+            break;
+        case flatJsonKeyHash("gasPrice"):
+            if (field.key() == QLatin1String("gasPrice"))
+                fields[GasPriceField] = &field;
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                fields[GasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("cumulativeGasUsed"):
+            if (field.key() == QLatin1String("cumulativeGasUsed"))
+                fields[CumulativeGasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("input"):
+            if (field.key() == QLatin1String("input"))
+                fields[InputField] = &field;
+            break;
+        case flatJsonKeyHash("confirmations"):
+            if (field.key() == QLatin1String("confirmations"))
+                fields[ConfirmationsField] = &field;
+            break;
+        }
+    }
+
+    m_blockNumber.append(fields[BlockNumberField] ? fields[BlockNumberField]->toInt() : InvalidBlockNumber);
+    m_timeStamp.append(fields[TimeStampField] ? fields[TimeStampField]->toLongLong() : 0);
+    m_hash.append(fields[HashField]);
+    m_nonce.append(fields[NonceField] ? fields[NonceField]->toULongLong() : 0);
+    m_blockHash.append(fields[BlockHashField]);
+    m_from.append(fields[FromField]);
+    m_contractAddress.append(fields[ContractAddressField]);
+    m_to.append(fields[ToField]);
+    m_value.append(fields[ValueStringField]);
+    m_tokenName.append(fields[TokenNameField]);
+    m_tokenSymbol.append(fields[TokenSymbolField]);
+    m_tokenDecimal.append(fields[TokenDecimalField] ? fields[TokenDecimalField]->toUShort() : 0);
+    m_transactionIndex.append(fields[TransactionIndexField] ? fields[TransactionIndexField]->toUInt() : 0);
+    m_gas.append(fields[GasField] ? fields[GasField]->toULongLong() : 0);
+    m_gasPrice.append(fields[GasPriceField] ? fields[GasPriceField]->toULongLong() : 0);
+    m_gasUsed.append(fields[GasUsedField] ? fields[GasUsedField]->toULongLong() : 0);
+    m_cumulativeGasUsed.append(fields[CumulativeGasUsedField] ? fields[CumulativeGasUsedField]->toULongLong() : 0);
+    m_input.append(fields[InputField]);
+    m_confirmations.append(fields[ConfirmationsField] ? fields[ConfirmationsField]->toULongLong() : 0);
+    m_count++;
+}
+
+ERC20TokenTransferEvent ERC20TokenTransferEventColumns::at(int row) const
+{
+    ERC20TokenTransferEvent result;
+    result.m_blockNumber = m_blockNumber.at(row);
+    result.m_timeStamp = m_timeStamp.at(row);
+    result.m_hash = m_hash.at(row);
+    result.m_nonce = m_nonce.at(row);
+    result.m_blockHash = m_blockHash.at(row);
+    result.m_from = m_from.at(row);
+    result.m_contractAddress = m_contractAddress.at(row);
+    result.m_to = m_to.at(row);
+    result.m_value = m_value.at(row);
+    result.m_tokenName = m_tokenName.at(row);
+    result.m_tokenSymbol = m_tokenSymbol.at(row);
+    result.m_tokenDecimal = m_tokenDecimal.at(row);
+    result.m_transactionIndex = m_transactionIndex.at(row);
+    result.m_gas = m_gas.at(row);
+    result.m_gasPrice = m_gasPrice.at(row);
+    result.m_gasUsed = m_gasUsed.at(row);
+    result.m_cumulativeGasUsed = m_cumulativeGasUsed.at(row);
+    result.m_input = m_input.at(row);
+    result.m_confirmations = m_confirmations.at(row);
+    return result;
+}
+
+ERC20TokenTransferEventList ERC20TokenTransferEventColumns::toList() const
+{
+    ERC20TokenTransferEventList result;
+    result.reserve(m_count);
+    for (int row = 0; row < m_count; row++)
+        result.append(at(row));
+    return result;
+}
+
+/*
+ **********************************************************************************************************************
+ *
+ * EventLogColumns
+ *
+ */
+
+EventLogColumns::EventLogColumns(const EventLogList& list) :
+    m_count{0}
+{
+    reserve(list.count());
+    for (const EventLog& row : list)
+        append(row);
+}
+
+void EventLogColumns::reserve(int rows)
+{
+    m_address.reserve(rows);
+    m_topics.reserve(rows * 3);
+    m_topicsEnds.reserve(rows);
+    m_dataString.reserve(rows);
+    m_blockNumber.reserve(rows);
+    m_blockHash.reserve(rows);
+    m_timeStamp.reserve(rows);
+    m_gasPrice.reserve(rows);
+    m_gasUsed.reserve(rows);
+    m_logIndexString.reserve(rows);
+    m_transactionHash.reserve(rows);
+    m_transactionIndexString.reserve(rows);
+}
+
+void EventLogColumns::append(const EventLog& row)
+{
+    m_address.append(row.m_address);
+    for (const QString& topic : row.m_topics)
+        m_topics.append(topic);
+    m_topicsEnds.append(m_topics.count());
+    m_dataString.append(row.m_dataString);
+    m_blockNumber.append(row.m_blockNumber);
+    m_blockHash.append(row.m_blockHash);
+    m_timeStamp.append(row.m_timeStamp);
+    m_gasPrice.append(row.m_gasPrice);
+    m_gasUsed.append(row.m_gasUsed);
+    m_logIndexString.append(row.m_logIndexString);
+    m_transactionHash.append(row.m_transactionHash);
+    m_transactionIndexString.append(row.m_transactionIndexString);
+    m_count++;
+}
+
+void EventLogColumns::append(const FlatJsonRecord& record)
+{
+    enum Field {
+        AddressField = 0,
+        TopicsField,
+        DataStringField,
+        BlockNumberField,
+        BlockHashField,
+        TimeStampField,
+        GasPriceField,
+        GasUsedField,
+        LogIndexStringField,
+        TransactionHashField,
+        TransactionIndexStringField,
+        FieldCount
+    };
+
+    const FlatJsonField* fields[FieldCount] = {};
+    for (const FlatJsonField& field : record) {
+        if (field.isArray() && field.key() != QLatin1String("topics"))
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("address"):
+            if (field.key() == QLatin1String("address"))
+                fields[AddressField] = &field;
+            break;
+        case flatJsonKeyHash("topics"):
+            if (field.key() == QLatin1String("topics"))
+                fields[TopicsField] = &field;
+            break;
+        case flatJsonKeyHash("data"):
+            if (field.key() == QLatin1String("data"))
+                fields[DataStringField] = &field;
+            break;
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                fields[BlockNumberField] = &field;
+            break;
+        case flatJsonKeyHash("blockHash"):
+            if (field.key() == QLatin1String("blockHash"))
+                fields[BlockHashField] = &field;
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                fields[TimeStampField] = &field;
+            break;
+        case flatJsonKeyHash("gasPrice"):
+            if (field.key() == QLatin1String("gasPrice"))
+                fields[GasPriceField] = &field;
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                fields[GasUsedField] = &field;
+            break;
+        case flatJsonKeyHash("logIndex"):
+            if (field.key() == QLatin1String("logIndex"))
+                fields[LogIndexStringField] = &field;
+            break;
+        case flatJsonKeyHash("transactionHash"):
+            if (field.key() == QLatin1String("transactionHash"))
+                fields[TransactionHashField] = &field;
+            break;
+        case flatJsonKeyHash("transactionIndex"):
+            if (field.key() == QLatin1String("transactionIndex"))
+                fields[TransactionIndexStringField] = &field;
+            break;
+        }
+    }
+
+    m_address.append(fields[AddressField]);
+    if (fields[TopicsField]) {
+        for (const QString& topic : fields[TopicsField]->toStringList())
+            m_topics.append(topic);
+    }
+    m_topicsEnds.append(m_topics.count());
+    m_dataString.append(fields[DataStringField]);
+    m_blockNumber.append(fields[BlockNumberField] ? fields[BlockNumberField]->toInt(0) : InvalidBlockNumber);
+    m_blockHash.append(fields[BlockHashField]);
+    m_timeStamp.append(fields[TimeStampField] ? fields[TimeStampField]->toLongLong(0) : 0);
+    m_gasPrice.append(fields[GasPriceField] ? fields[GasPriceField]->toULongLong(0) : 0);
+    m_gasUsed.append(fields[GasUsedField] ? fields[GasUsedField]->toULongLong(0) : 0);
+    m_logIndexString.append(fields[LogIndexStringField]);
+    m_transactionHash.append(fields[TransactionHashField]);
+    m_transactionIndexString.append(fields[TransactionIndexStringField]);
+    m_count++;
+}
+
+EventLog EventLogColumns::at(int row) const
+{
+    EventLog result;
+    result.m_address = m_address.at(row);
+    for (int i = topicsBegin(row); i < m_topicsEnds.at(row); i++)
+        result.m_topics.append(m_topics.at(i));
+    result.m_dataString = m_dataString.at(row);
+    result.m_blockNumber = m_blockNumber.at(row);
+    result.m_blockHash = m_blockHash.at(row);
+    result.m_timeStamp = m_timeStamp.at(row);
+    result.m_gasPrice = m_gasPrice.at(row);
+    result.m_gasUsed = m_gasUsed.at(row);
+    result.m_logIndexString = m_logIndexString.at(row);
+    result.m_transactionHash = m_transactionHash.at(row);
+    result.m_transactionIndexString = m_transactionIndexString.at(row);
+    return result;
+}
+
+EventLogList EventLogColumns::toList() const
+{
+    EventLogList result;
+    result.reserve(m_count);
+    for (int row = 0; row < m_count; row++)
+        result.append(at(row));
+    return result;
+}
+} //namespace QtEtherscan
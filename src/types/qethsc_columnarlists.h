@@ -0,0 +1,512 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_COLUMNARLISTS_H
+#define QT_ETHERSCAN_COLUMNARLISTS_H
+
+#include <QVector>
+
+#include <utility>
+
+#include "./qethsc_columns.h"
+#include "./qethsc_erc20tokentransferevent.h"
+#include "./qethsc_eventlogs.h"
+#include "./qethsc_flatjson.h"
+#include "./qethsc_internaltransaction.h"
+#include "./qethsc_transaction.h"
+
+namespace QtEtherscan {
+
+/*! @brief This trait gives columnar form of the list type L. It is defined only for lists which have columnar form. */
+template<class L>
+struct ColumnarListOf;
+
+/*! @class TransactionColumns src/types/qethsc_columnarlists.h
+ *  @brief Columnar form of the TransactionList, which is returned by API::fetchColumns. Every field is stored in its
+ *         own contiguous array, so scanning single field does not touch other ones. */
+
+class TransactionColumns
+{
+public:
+    typedef Transaction     Row;
+    typedef TransactionList List;
+
+    TransactionColumns() :
+        m_count{0} {}
+
+    /*! @brief Constructs columns from the list of Transaction objects. */
+    TransactionColumns(const TransactionList& list);
+
+    /*! @brief Returns number of rows. */
+    int            count() const                           { return m_count; }
+    bool           isEmpty() const                         { return m_count == 0; }
+
+    void           reserve(int rows);
+
+    /*! @brief Appends row. */
+    void           append(const Transaction& row);
+
+    /*! @brief Appends row read by FlatJsonReader. Values are copied to the columns without creating Transaction. */
+    void           append(const FlatJsonRecord& record);
+
+    /*! @brief Returns row as Transaction object. */
+    Transaction at(int row) const;
+
+    /*! @brief Returns all rows as TransactionList. */
+    TransactionList toList() const;
+
+    /*! @brief Returns "blockNumber" fields of all rows. */
+    const QVector<qint32>& blockNumber() const             { return m_blockNumber; }
+
+    /*! @brief Returns "timeStamp" fields of all rows. Values are seconds since epoch. */
+    const QVector<qint64>& timeStamp() const               { return m_timeStamp; }
+
+    /*! @brief Returns "hash" fields of all rows. */
+    const StringColumn& hash() const                       { return m_hash; }
+
+    /*! @brief Returns "nonce" fields of all rows. */
+    const QVector<quint64>& nonce() const                  { return m_nonce; }
+
+    /*! @brief Returns "blockHash" fields of all rows. */
+    const DictionaryColumn& blockHash() const              { return m_blockHash; }
+
+    /*! @brief Returns "transactionIndex" fields of all rows. */
+    const QVector<quint32>& transactionIndex() const       { return m_transactionIndex; }
+
+    /*! @brief Returns "from" fields of all rows. */
+    const DictionaryColumn& from() const                   { return m_from; }
+
+    /*! @brief Returns "to" fields of all rows. */
+    const DictionaryColumn& to() const                     { return m_to; }
+
+    /*! @brief Returns "value" fields of all rows as wei strings. */
+    const StringColumn& valueString() const                { return m_valueString; }
+
+    /*! @brief Returns "value" fields of all rows as wei. Values are not exact for the big amounts, same as Ether::wei. */
+    const QVector<double>& valueWei() const                { return m_valueWei; }
+
+    /*! @brief Returns "gas" fields of all rows. */
+    const QVector<quint64>& gas() const                    { return m_gas; }
+
+    /*! @brief Returns "gasPrice" fields of all rows. */
+    const QVector<quint64>& gasPrice() const               { return m_gasPrice; }
+
+    /*! @brief Returns "isError" fields of all rows. */
+    const DictionaryColumn& isErrorString() const          { return m_isErrorString; }
+
+    /*! @brief Returns "txreceipt_status" fields of all rows. */
+    const DictionaryColumn& txreceiptStatusString() const  { return m_txreceiptStatusString; }
+
+    /*! @brief Returns "input" fields of all rows. */
+    const StringColumn& input() const                      { return m_input; }
+
+    /*! @brief Returns "contractAddress" fields of all rows. */
+    const DictionaryColumn& contractAddress() const        { return m_contractAddress; }
+
+    /*! @brief Returns "cumulativeGasUsed" fields of all rows. */
+    const QVector<quint64>& cumulativeGasUsed() const      { return m_cumulativeGasUsed; }
+
+    /*! @brief Returns "gasUsed" fields of all rows. */
+    const QVector<quint64>& gasUsed() const                { return m_gasUsed; }
+
+    /*! @brief Returns "confirmations" fields of all rows. */
+    const QVector<quint64>& confirmations() const          { return m_confirmations; }
+
+    /*! @brief Returns "methodId" fields of all rows. */
+    const DictionaryColumn& methodIdString() const         { return m_methodIdString; }
+
+    /*! @brief Returns "functionName" fields of all rows. */
+    const DictionaryColumn& functionName() const           { return m_functionName; }
+
+private:
+    int              m_count;
+    QVector<qint32>  m_blockNumber;
+    QVector<qint64>  m_timeStamp;
+    StringColumn     m_hash;
+    QVector<quint64> m_nonce;
+    DictionaryColumn m_blockHash;
+    QVector<quint32> m_transactionIndex;
+    DictionaryColumn m_from;
+    DictionaryColumn m_to;
+    StringColumn     m_valueString;
+    QVector<double>  m_valueWei;
+    QVector<quint64> m_gas;
+    QVector<quint64> m_gasPrice;
+    DictionaryColumn m_isErrorString;
+    DictionaryColumn m_txreceiptStatusString;
+    StringColumn     m_input;
+    DictionaryColumn m_contractAddress;
+    QVector<quint64> m_cumulativeGasUsed;
+    QVector<quint64> m_gasUsed;
+    QVector<quint64> m_confirmations;
+    DictionaryColumn m_methodIdString;
+    DictionaryColumn m_functionName;
+};
+
+template<>
+struct ColumnarListOf<TransactionList> { typedef TransactionColumns type; };
+
+/*! @class InternalTransactionColumns src/types/qethsc_columnarlists.h
+ *  @brief Columnar form of the InternalTransactionList, which is returned by API::fetchColumns. Every field is stored in its
+ *         own contiguous array, so scanning single field does not touch other ones. */
+
+class InternalTransactionColumns
+{
+public:
+    typedef InternalTransaction     Row;
+    typedef InternalTransactionList List;
+
+    InternalTransactionColumns() :
+        m_count{0} {}
+
+    /*! @brief Constructs columns from the list of InternalTransaction objects. */
+    InternalTransactionColumns(const InternalTransactionList& list);
+
+    /*! @brief Returns number of rows. */
+    int            count() const                           { return m_count; }
+    bool           isEmpty() const                         { return m_count == 0; }
+
+    void           reserve(int rows);
+
+    /*! @brief Appends row. */
+    void           append(const InternalTransaction& row);
+
+    /*! @brief Appends row read by FlatJsonReader. Values are copied to the columns without creating InternalTransaction. */
+    void           append(const FlatJsonRecord& record);
+
+    /*! @brief Returns row as InternalTransaction object. */
+    InternalTransaction at(int row) const;
+
+    /*! @brief Returns all rows as InternalTransactionList. */
+    InternalTransactionList toList() const;
+
+    /*! @brief Returns "blockNumber" fields of all rows. */
+    const QVector<qint32>& blockNumber() const             { return m_blockNumber; }
+
+    /*! @brief Returns "timeStamp" fields of all rows. Values are seconds since epoch. */
+    const QVector<qint64>& timeStamp() const               { return m_timeStamp; }
+
+    /*! @brief Returns "hash" fields of all rows. */
+    const DictionaryColumn& hash() const                   { return m_hash; }
+
+    /*! @brief Returns "from" fields of all rows. */
+    const DictionaryColumn& from() const                   { return m_from; }
+
+    /*! @brief Returns "to" fields of all rows. */
+    const DictionaryColumn& to() const                     { return m_to; }
+
+    /*! @brief Returns "value" fields of all rows as wei strings. */
+    const StringColumn& valueString() const                { return m_valueString; }
+
+    /*! @brief Returns "value" fields of all rows as wei. Values are not exact for the big amounts, same as Ether::wei. */
+    const QVector<double>& valueWei() const                { return m_valueWei; }
+
+    /*! @brief Returns "contractAddress" fields of all rows. */
+    const DictionaryColumn& contractAddress() const        { return m_contractAddress; }
+
+    /*! @brief Returns "input" fields of all rows. */
+    const StringColumn& input() const                      { return m_input; }
+
+    /*! @brief Returns "type" fields of all rows. */
+    const DictionaryColumn& typeString() const             { return m_typeString; }
+
+    /*! @brief Returns "gas" fields of all rows. */
+    const QVector<quint64>& gas() const                    { return m_gas; }
+
+    /*! @brief Returns "gasUsed" fields of all rows. */
+    const QVector<quint64>& gasUsed() const                { return m_gasUsed; }
+
+    /*! @brief Returns "traceId" fields of all rows. */
+    const DictionaryColumn& traceIdString() const          { return m_traceIdString; }
+
+    /*! @brief Returns "isError" fields of all rows. */
+    const DictionaryColumn& isErrorString() const          { return m_isErrorString; }
+
+    /*! @brief Returns "errCode" fields of all rows. */
+    const DictionaryColumn& errCodeString() const          { return m_errCodeString; }
+
+private:
+    int              m_count;
+    QVector<qint32>  m_blockNumber;
+    QVector<qint64>  m_timeStamp;
+    DictionaryColumn m_hash;
+    DictionaryColumn m_from;
+    DictionaryColumn m_to;
+    StringColumn     m_valueString;
+    QVector<double>  m_valueWei;
+    DictionaryColumn m_contractAddress;
+    StringColumn     m_input;
+    DictionaryColumn m_typeString;
+    QVector<quint64> m_gas;
+    QVector<quint64> m_gasUsed;
+    DictionaryColumn m_traceIdString;
+    DictionaryColumn m_isErrorString;
+    DictionaryColumn m_errCodeString;
+};
+
+template<>
+struct ColumnarListOf<InternalTransactionList> { typedef InternalTransactionColumns type; };
+
+/*! @class ERC20TokenTransferEventColumns src/types/qethsc_columnarlists.h
+ *  @brief Columnar form of the ERC20TokenTransferEventList, which is returned by API::fetchColumns. Every field is stored in its
+ *         own contiguous array, so scanning single field does not touch other ones. */
+
+class ERC20TokenTransferEventColumns
+{
+public:
+    typedef ERC20TokenTransferEvent     Row;
+    typedef ERC20TokenTransferEventList List;
+
+    ERC20TokenTransferEventColumns() :
+        m_count{0} {}
+
+    /*! @brief Constructs columns from the list of ERC20TokenTransferEvent objects. */
+    ERC20TokenTransferEventColumns(const ERC20TokenTransferEventList& list);
+
+    /*! @brief Returns number of rows. */
+    int            count() const                           { return m_count; }
+    bool           isEmpty() const                         { return m_count == 0; }
+
+    void           reserve(int rows);
+
+    /*! @brief Appends row. */
+    void           append(const ERC20TokenTransferEvent& row);
+
+    /*! @brief Appends row read by FlatJsonReader. Values are copied to the columns without creating ERC20TokenTransferEvent. */
+    void           append(const FlatJsonRecord& record);
+
+    /*! @brief Returns row as ERC20TokenTransferEvent object. */
+    ERC20TokenTransferEvent at(int row) const;
+
+    /*! @brief Returns all rows as ERC20TokenTransferEventList. */
+    ERC20TokenTransferEventList toList() const;
+
+    /*! @brief Returns "blockNumber" fields of all rows. */
+    const QVector<qint32>& blockNumber() const             { return m_blockNumber; }
+
+    /*! @brief Returns "timeStamp" fields of all rows. Values are seconds since epoch. */
+    const QVector<qint64>& timeStamp() const               { return m_timeStamp; }
+
+    /*! @brief Returns "hash" fields of all rows. */
+    const StringColumn& hash() const                       { return m_hash; }
+
+    /*! @brief Returns "nonce" fields of all rows. */
+    const QVector<quint64>& nonce() const                  { return m_nonce; }
+
+    /*! @brief Returns "blockHash" fields of all rows. */
+    const DictionaryColumn& blockHash() const              { return m_blockHash; }
+
+    /*! @brief Returns "from" fields of all rows. */
+    const DictionaryColumn& from() const                   { return m_from; }
+
+    /*! @brief Returns "contractAddress" fields of all rows. */
+    const DictionaryColumn& contractAddress() const        { return m_contractAddress; }
+
+    /*! @brief Returns "to" fields of all rows. */
+    const DictionaryColumn& to() const                     { return m_to; }
+
+    /*! @brief Returns "value" fields of all rows. */
+    const StringColumn& valueString() const                { return m_value; }
+
+    /*! @brief Returns "tokenName" fields of all rows. */
+    const DictionaryColumn& tokenName() const              { return m_tokenName; }
+
+    /*! @brief Returns "tokenSymbol" fields of all rows. */
+    const DictionaryColumn& tokenSymbol() const            { return m_tokenSymbol; }
+
+    /*! @brief Returns "tokenDecimal" fields of all rows. */
+    const QVector<quint16>& tokenDecimal() const           { return m_tokenDecimal; }
+
+    /*! @brief Returns "transactionIndex" fields of all rows. */
+    const QVector<quint32>& transactionIndex() const       { return m_transactionIndex; }
+
+    /*! @brief Returns "gas" fields of all rows. */
+    const QVector<quint64>& gas() const                    { return m_gas; }
+
+    /*! @brief Returns "gasPrice" fields of all rows. */
+    const QVector<quint64>& gasPrice() const               { return m_gasPrice; }
+
+    /*! @brief Returns "gasUsed" fields of all rows. */
+    const QVector<quint64>& gasUsed() const                { return m_gasUsed; }
+
+    /*! @brief Returns "cumulativeGasUsed" fields of all rows. */
+    const QVector<quint64>& cumulativeGasUsed() const      { return m_cumulativeGasUsed; }
+
+    /*! @brief Returns "input" fields of all rows. */
+    const StringColumn& input() const                      { return m_input; }
+
+    /*! @brief Returns "confirmations" fields of all rows. */
+    const QVector<quint64>& confirmations() const          { return m_confirmations; }
+
+private:
+    int              m_count;
+    QVector<qint32>  m_blockNumber;
+    QVector<qint64>  m_timeStamp;
+    StringColumn     m_hash;
+    QVector<quint64> m_nonce;
+    DictionaryColumn m_blockHash;
+    DictionaryColumn m_from;
+    DictionaryColumn m_contractAddress;
+    DictionaryColumn m_to;
+    StringColumn     m_value;
+    DictionaryColumn m_tokenName;
+    DictionaryColumn m_tokenSymbol;
+    QVector<quint16> m_tokenDecimal;
+    QVector<quint32> m_transactionIndex;
+    QVector<quint64> m_gas;
+    QVector<quint64> m_gasPrice;
+    QVector<quint64> m_gasUsed;
+    QVector<quint64> m_cumulativeGasUsed;
+    StringColumn     m_input;
+    QVector<quint64> m_confirmations;
+};
+
+template<>
+struct ColumnarListOf<ERC20TokenTransferEventList> { typedef ERC20TokenTransferEventColumns type; };
+
+/*! @class EventLogColumns src/types/qethsc_columnarlists.h
+ *  @brief Columnar form of the EventLogList, which is returned by API::fetchColumns. Every field is stored in its
+ *         own contiguous array, so scanning single field does not touch other ones. */
+
+class EventLogColumns
+{
+public:
+    typedef EventLog     Row;
+    typedef EventLogList List;
+
+    EventLogColumns() :
+        m_count{0} {}
+
+    /*! @brief Constructs columns from the list of EventLog objects. */
+    EventLogColumns(const EventLogList& list);
+
+    /*! @brief Returns number of rows. */
+    int            count() const                           { return m_count; }
+    bool           isEmpty() const                         { return m_count == 0; }
+
+    void           reserve(int rows);
+
+    /*! @brief Appends row. */
+    void           append(const EventLog& row);
+
+    /*! @brief Appends row read by FlatJsonReader. Values are copied to the columns without creating EventLog. */
+    void           append(const FlatJsonRecord& record);
+
+    /*! @brief Returns row as EventLog object. */
+    EventLog at(int row) const;
+
+    /*! @brief Returns all rows as EventLogList. */
+    EventLogList toList() const;
+
+    /*! @brief Returns "address" fields of all rows. */
+    const DictionaryColumn& address() const                { return m_address; }
+
+    /*! @brief Returns topics of all rows one after another. Topics of the row start at topicsBegin(row). */
+    const DictionaryColumn& topics() const                 { return m_topics; }
+
+    /*! @brief Returns index of the first topic of the row in topics() column. */
+    int            topicsBegin(int row) const              { return (row == 0) ? 0 : m_topicsEnds.at(row - 1); }
+
+    /*! @brief Returns number of topics of the row. */
+    int            topicCount(int row) const               { return m_topicsEnds.at(row) - topicsBegin(row); }
+
+    /*! @brief Returns "data" fields of all rows. */
+    const StringColumn& dataString() const                 { return m_dataString; }
+
+    /*! @brief Returns "blockNumber" fields of all rows. */
+    const QVector<qint32>& blockNumber() const             { return m_blockNumber; }
+
+    /*! @brief Returns "blockHash" fields of all rows. */
+    const DictionaryColumn& blockHash() const              { return m_blockHash; }
+
+    /*! @brief Returns "timeStamp" fields of all rows. Values are seconds since epoch. */
+    const QVector<qint64>& timeStamp() const               { return m_timeStamp; }
+
+    /*! @brief Returns "gasPrice" fields of all rows. */
+    const QVector<quint64>& gasPrice() const               { return m_gasPrice; }
+
+    /*! @brief Returns "gasUsed" fields of all rows. */
+    const QVector<quint64>& gasUsed() const                { return m_gasUsed; }
+
+    /*! @brief Returns "logIndex" fields of all rows. */
+    const DictionaryColumn& logIndexString() const         { return m_logIndexString; }
+
+    /*! @brief Returns "transactionHash" fields of all rows. */
+    const DictionaryColumn& transactionHash() const        { return m_transactionHash; }
+
+    /*! @brief Returns "transactionIndex" fields of all rows. */
+    const DictionaryColumn& transactionIndexString() const { return m_transactionIndexString; }
+
+private:
+    int              m_count;
+    DictionaryColumn m_address;
+    DictionaryColumn m_topics;
+    QVector<int>     m_topicsEnds;
+    StringColumn     m_dataString;
+    QVector<qint32>  m_blockNumber;
+    DictionaryColumn m_blockHash;
+    QVector<qint64>  m_timeStamp;
+    QVector<quint64> m_gasPrice;
+    QVector<quint64> m_gasUsed;
+    DictionaryColumn m_logIndexString;
+    DictionaryColumn m_transactionHash;
+    DictionaryColumn m_transactionIndexString;
+};
+
+template<>
+struct ColumnarListOf<EventLogList> { typedef EventLogColumns type; };
+
+/*! @brief Decodes successful reply with array of flat objects directly into columns. Fields, filter and envelope
+ *         have the same meaning as in decodeFlatJsonList. Returns false if reply can not be decoded this way, columns
+ *         are not modified in such case. */
+template<class Columns>
+bool decodeFlatJsonColumns(const QByteArray& data, Columns* columns, const QStringList& fields = QStringList(),
+                           const RecordFilter& filter = RecordFilter(), QJsonObject* envelope = nullptr)
+{
+    FlatJsonReader reader(data);
+    reader.setFields(fields);
+    reader.setFilter(filter);
+    if (!reader.readEnvelope())
+        return false;
+
+    Columns result;
+    // With filter most of the objects may be dropped, so storage grows as needed
+    if (filter.isEmpty())
+        result.reserve(reader.countRecords());
+    FlatJsonRecord record;
+    while (reader.readRecord(&record))
+        result.append(record);
+
+    if (!reader.atEnd())
+        return false;
+
+    *columns = std::move(result);
+    if (envelope)
+        *envelope = reader.envelope();
+    return true;
+}
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_COLUMNARLISTS_H
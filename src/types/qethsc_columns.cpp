@@ -0,0 +1,96 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_columns.h"
+
+namespace QtEtherscan {
+
+/*
+ **********************************************************************************************************************
+ *
+ * StringColumn
+ *
+ */
+
+void StringColumn::append(const QString& string)
+{
+    const QByteArray data = string.toUtf8();
+    append(data.constData(),data.size());
+}
+
+void StringColumn::append(const FlatJsonField* field)
+{
+    if (field == nullptr) {
+        append(nullptr,0);
+    } else if (field->isEscaped()) {
+        append(field->toString());
+    } else {
+        append(field->rawValue(),field->rawValueLength());
+    }
+}
+
+/*
+ **********************************************************************************************************************
+ *
+ * DictionaryColumn
+ *
+ */
+
+void DictionaryColumn::append(const QString& string)
+{
+    const QByteArray data = string.toUtf8();
+    append(data.constData(),data.size());
+}
+
+void DictionaryColumn::append(const FlatJsonField* field)
+{
+    if (field == nullptr) {
+        append(nullptr,0);
+    } else if (field->isEscaped()) {
+        append(field->toString());
+    } else {
+        append(field->rawValue(),field->rawValueLength());
+    }
+}
+
+qint64 DictionaryColumn::findValue(const QString& value) const
+{
+    const QHash<QByteArray,quint32>::const_iterator it = m_index.constFind(value.toUtf8());
+    return (it != m_index.constEnd()) ? qint64(it.value()) : -1;
+}
+
+quint32 DictionaryColumn::valueId(const char* data, int length)
+{
+    // Lookup does not copy the data, key is copied only when new value is added
+    const QHash<QByteArray,quint32>::const_iterator it = m_index.constFind(QByteArray::fromRawData(data,length));
+    if (it != m_index.constEnd())
+        return it.value();
+
+    const quint32 id = quint32(m_values.count());
+    m_values.append(data,length);
+    m_index.insert(QByteArray(data,length),id);
+    return id;
+}
+
+} //namespace QtEtherscan
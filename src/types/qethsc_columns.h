@@ -0,0 +1,126 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_COLUMNS_H
+#define QT_ETHERSCAN_COLUMNS_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "./qethsc_flatjson.h"
+
+namespace QtEtherscan {
+
+/*! @class StringColumn src/types/qethsc_columns.h
+ *  @brief Object of this class stores strings of the single column of the columnar list. All strings are stored as
+ *         UTF-8 in one contiguous buffer, so column has two allocations regardless of number of rows. */
+
+class StringColumn
+{
+public:
+    StringColumn() {}
+
+    /*! @brief Returns number of strings in this column. */
+    int            count() const                           { return m_ends.count(); }
+
+    void           reserve(int rows)                       { m_ends.reserve(rows); }
+
+    /*! @brief Appends UTF-8 string. */
+    void           append(const char* data, int length)    { m_data.append(data,length); m_ends.append(m_data.size()); }
+    void           append(const QString& string);
+
+    /*! @brief Appends raw value of the field. Escape sequences are decoded. If field is nullptr - empty string is
+     *         appended. */
+    void           append(const FlatJsonField* field);
+
+    /*! @brief Returns string at row. */
+    QString        at(int row) const                       { return QString::fromUtf8(data(row),size(row)); }
+
+    /*! @brief Returns pointer to the UTF-8 bytes of the string at row. Bytes are not null-terminated. */
+    const char*    data(int row) const                     { return m_data.constData() + begin(row); }
+
+    /*! @brief Returns size of the string at row in bytes. */
+    int            size(int row) const                     { return m_ends.at(row) - begin(row); }
+
+private:
+    int            begin(int row) const                    { return (row == 0) ? 0 : m_ends.at(row - 1); }
+
+    QByteArray     m_data;
+    QVector<int>   m_ends;
+};
+
+/*! @class DictionaryColumn src/types/qethsc_columns.h
+ *  @brief Object of this class stores strings of the single column, which have many repeating values (addresses,
+ *         block hashes, flags). Every distinct value is stored once, rows hold 32-bit ids of the values. Ids can be
+ *         used for grouping and comparisons without touching strings. */
+
+class DictionaryColumn
+{
+public:
+    DictionaryColumn() {}
+
+    /*! @brief Returns number of rows in this column. */
+    int            count() const                           { return m_ids.count(); }
+
+    /*! @brief Returns number of distinct values in this column. */
+    int            valueCount() const                      { return m_values.count(); }
+
+    void           reserve(int rows)                       { m_ids.reserve(rows); }
+
+    /*! @brief Appends UTF-8 string. */
+    void           append(const char* data, int length)    { m_ids.append(valueId(data,length)); }
+    void           append(const QString& string);
+
+    /*! @brief Appends raw value of the field. Escape sequences are decoded. If field is nullptr - empty string is
+     *         appended. */
+    void           append(const FlatJsonField* field);
+
+    /*! @brief Returns ids of the values of all rows. */
+    const QVector<quint32>& ids() const                    { return m_ids; }
+
+    /*! @brief Returns id of the value at row. */
+    quint32        idAt(int row) const                     { return m_ids.at(row); }
+
+    /*! @brief Returns value with specified id. */
+    QString        value(quint32 id) const                 { return m_values.at(int(id)); }
+
+    /*! @brief Returns id of the value or -1 if this column has no such value. */
+    qint64         findValue(const QString& value) const;
+
+    /*! @brief Returns string at row. */
+    QString        at(int row) const                       { return m_values.at(int(m_ids.at(row))); }
+
+private:
+    quint32        valueId(const char* data, int length);
+
+    QVector<quint32>       m_ids;
+    StringColumn           m_values;
+    QHash<QByteArray,quint32> m_index;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_COLUMNS_H
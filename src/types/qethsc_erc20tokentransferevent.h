@@ -29,6 +29,7 @@
 #include <QJsonObject>
 
 #include "./qethsc_constants.h"
+#include "./qethsc_flatjson.h"
 #include "./qethsc_jsonobjectslist.h"
 
 namespace QtEtherscan {
@@ -47,6 +48,10 @@ public:
     ERC20TokenTransferEvent(const QJsonValue& jsonValue) :
         ERC20TokenTransferEvent(jsonValue.toObject()) {}
 
+    /*! @brief Constructs ERC20TokenTransferEvent object from the record read by FlatJsonReader. Gives the same result as
+     *         constructor taking QJsonObject, but values are decoded directly from the reply data. */
+    ERC20TokenTransferEvent(const FlatJsonRecord& record);
+
     /*! @brief Returns true if this ERC20TokenTransferEvent object is valid and contains reasonable information.
      *         ERC20TokenTransferEvent object is considered to be valid if blockNumber() contains anything but not -1. */
     bool      isValid() const               { return m_blockNumber != InvalidBlockNumber; }
@@ -112,6 +117,8 @@ public:
     quint64   confirmations() const         { return m_confirmations; }
 
 private:
+    friend class ERC20TokenTransferEventColumns;
+
     qint32    m_blockNumber;
     qint64    m_timeStamp;
     QString   m_hash;
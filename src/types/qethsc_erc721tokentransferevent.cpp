@@ -61,4 +61,93 @@ ERC721TokenTransferEvent::ERC721TokenTransferEvent(const QJsonObject& jsonObject
     m_confirmations     {jsonObject.value("confirmations").toString().toULongLong()                     }
 {}
 
+ERC721TokenTransferEvent::ERC721TokenTransferEvent(const FlatJsonRecord& record) :
+    ERC721TokenTransferEvent()
+{
+    for (const FlatJsonField& field : record) {
+        if (field.isArray())
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                m_blockNumber = field.toInt();
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                m_timeStamp = field.toLongLong();
+            break;
+        case flatJsonKeyHash("hash"):
+            if (field.key() == QLatin1String("hash"))
+                m_hash = field.toString();
+            break;
+        case flatJsonKeyHash("nonce"):
+            if (field.key() == QLatin1String("nonce"))
+                m_nonce = field.toULongLong();
+            break;
+        case flatJsonKeyHash("blockHash"):
+            if (field.key() == QLatin1String("blockHash"))
+                m_blockHash = field.toSharedString();
+            break;
+        case flatJsonKeyHash("from"):
+            if (field.key() == QLatin1String("from"))
+                m_from = field.toSharedString();
+            break;
+        case flatJsonKeyHash("contractAddress"):
+            if (field.key() == QLatin1String("contractAddress"))
+                m_contractAddress = field.toSharedString();
+            break;
+        case flatJsonKeyHash("to"):
+            if (field.key() == QLatin1String("to"))
+                m_to = field.toSharedString();
+            break;
+        case flatJsonKeyHash("tokenID"):
+            if (field.key() == QLatin1String("tokenID"))
+                m_tokenIdString = field.toString();
+            break;
+        case flatJsonKeyHash("tokenName"):
+            if (field.key() == QLatin1String("tokenName"))
+                m_tokenName = field.toSharedString();
+            break;
+        case flatJsonKeyHash("tokenSymbol"):
+            if (field.key() == QLatin1String("tokenSymbol"))
+                m_tokenSymbol = field.toSharedString();
+            break;
+        case flatJsonKeyHash("tokenDecimal"):
+            if (field.key() == QLatin1String("tokenDecimal"))
+                m_tokenDecimal = field.toUInt();
+            break;
+        case flatJsonKeyHash("transactionIndex"):
+            if (field.key() == QLatin1String("transactionIndex"))
+                m_transactionIndex = field.toUInt();
+            break;
+        case flatJsonKeyHash("gas"):
+            if (field.key() == QLatin1String("gas"))
+                m_gas = field.toULongLong();
+            break;
+        case flatJsonKeyHash("gasPrice"):
+            if (field.key() == QLatin1String("gasPrice"))
+                m_gasPrice = field.toULongLong();
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                m_gasUsed = field.toULongLong();
+            break;
+        case flatJsonKeyHash("cumulativeGasUsed"):
+            if (field.key() == QLatin1String("cumulativeGasUsed"))
+                m_cumulativeGasUsed = field.toULongLong();
+            break;
+        case flatJsonKeyHash("input"):
+            if (field.key() == QLatin1String("input"))
+                m_input = field.toSharedString();
+            break;
+        case flatJsonKeyHash("confirmations"):
+            if (field.key() == QLatin1String("confirmations"))
+                m_confirmations = field.toULongLong();
+            break;
+        }
+    }
+}
+
 } //namespace QtEtherscan
@@ -29,6 +29,7 @@
 #include <QJsonObject>
 
 #include "./qethsc_constants.h"
+#include "./qethsc_flatjson.h"
 #include "./qethsc_jsonobjectslist.h"
 
 namespace QtEtherscan {
@@ -47,6 +48,10 @@ public:
     ERC721TokenTransferEvent(const QJsonValue& jsonValue) :
         ERC721TokenTransferEvent(jsonValue.toObject()) {}
 
+    /*! @brief Constructs ERC721TokenTransferEvent object from the record read by FlatJsonReader. Gives the same result as
+     *         constructor taking QJsonObject, but values are decoded directly from the reply data. */
+    ERC721TokenTransferEvent(const FlatJsonRecord& record);
+
     /*! @brief Returns true if this ERC721TokenTransferEvent object is valid and contains reasonable information.
      *         ERC721TokenTransferEvent object is considered to be valid if blockNumber() contains anything but not -1. */
     bool      isValid() const               { return m_blockNumber != InvalidBlockNumber; }
@@ -49,4 +49,61 @@ EventLog::EventLog(const QJsonObject& jsonObject) :
         m_topics.append(value.toString());
 }
 
+EventLog::EventLog(const FlatJsonRecord& record) :
+    EventLog()
+{
+    for (const FlatJsonField& field : record) {
+        if (field.isArray() && field.key() != QLatin1String("topics"))
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("address"):
+            if (field.key() == QLatin1String("address"))
+                m_address = field.toSharedString();
+            break;
+        case flatJsonKeyHash("topics"):
+            if (field.key() == QLatin1String("topics"))
+                m_topics = field.toStringList();
+            break;
+        case flatJsonKeyHash("data"):
+            if (field.key() == QLatin1String("data"))
+                m_dataString = field.toString();
+            break;
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                m_blockNumber = field.toInt(0);
+            break;
+        case flatJsonKeyHash("blockHash"):
+            if (field.key() == QLatin1String("blockHash"))
+                m_blockHash = field.toSharedString();
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                m_timeStamp = field.toLongLong(0);
+            break;
+        case flatJsonKeyHash("gasPrice"):
+            if (field.key() == QLatin1String("gasPrice"))
+                m_gasPrice = field.toULongLong(0);
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                m_gasUsed = field.toULongLong(0);
+            break;
+        case flatJsonKeyHash("logIndex"):
+            if (field.key() == QLatin1String("logIndex"))
+                m_logIndexString = field.toString();
+            break;
+        case flatJsonKeyHash("transactionHash"):
+            if (field.key() == QLatin1String("transactionHash"))
+                m_transactionHash = field.toSharedString();
+            break;
+        case flatJsonKeyHash("transactionIndex"):
+            if (field.key() == QLatin1String("transactionIndex"))
+                m_transactionIndexString = field.toString();
+            break;
+        }
+    }
+}
+
 } //namespace QtEtherscan
@@ -29,6 +29,7 @@
 #include <QJsonObject>
 
 #include "./qethsc_constants.h"
+#include "./qethsc_flatjson.h"
 #include "./qethsc_jsonobjectslist.h"
 
 namespace QtEtherscan {
@@ -50,6 +51,10 @@ public:
     EventLog(const QJsonValue& jsonValue) :
         EventLog(jsonValue.toObject()) {}
 
+    /*! @brief Constructs EventLog object from the record read by FlatJsonReader. Gives the same result as
+     *         constructor taking QJsonObject, but values are decoded directly from the reply data. */
+    EventLog(const FlatJsonRecord& record);
+
     /*! @brief Returns true if this EventLog object is valid and contains reasonable information. EventLog object is considered
      *         to be valid if blockNumber() contains anything but not -1. */
     bool           isValid() const                    { return m_blockNumber != InvalidBlockNumber; }
@@ -90,6 +95,8 @@ public:
     QString        transactionIndexString() const     { return m_transactionIndexString; }
 
 private:
+    friend class EventLogColumns;
+
     QString        m_address;
     QStringList    m_topics;
     QString        m_dataString;
@@ -0,0 +1,651 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_flatjson.h"
+
+#include <limits>
+
+namespace QtEtherscan {
+
+/*
+ **********************************************************************************************************************
+ *
+ * FlatJsonField
+ *
+ */
+
+static bool isJsonWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static int hexDigit(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool readHex4(const char* pos, const char* end, char16_t* result)
+{
+    if (end - pos < 4)
+        return false;
+
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        const int digit = hexDigit(pos[i]);
+        if (digit < 0)
+            return false;
+        value = value * 16 + digit;
+    }
+    *result = static_cast<char16_t>(value);
+    return true;
+}
+
+static bool isNumberWhitespace(char c)
+{
+    return isJsonWhitespace(c) || c == '\v' || c == '\f';
+}
+
+// Integers are parsed in the same way as by QString::toLongLong: surrounding whitespace and sign are allowed, base 0
+// means C language convention ("0x" - hexadecimal, leading "0" - octal)
+static bool parseNumber(const char* pos, const char* end, int base, bool* negative, quint64* result)
+{
+    while (pos < end && isNumberWhitespace(*pos))
+        pos++;
+    while (end > pos && isNumberWhitespace(*(end - 1)))
+        end--;
+
+    *negative = false;
+    if (pos < end && (*pos == '-' || *pos == '+')) {
+        *negative = (*pos == '-');
+        pos++;
+    }
+
+    const bool hexPrefix = (end - pos > 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X'));
+    if (base == 0)
+        base = hexPrefix ? 16 : (end - pos > 1 && pos[0] == '0') ? 8 : 10;
+    if (base == 16 && hexPrefix)
+        pos += 2;
+
+    if (pos == end)
+        return false;
+
+    constexpr quint64 maxValue = std::numeric_limits<quint64>::max();
+    quint64 value = 0;
+    for (; pos < end; pos++) {
+        const int digit = hexDigit(*pos);
+        if (digit < 0 || digit >= base)
+            return false;
+
+        if (value > (maxValue - quint64(digit)) / quint64(base))
+            return false;
+        value = value * quint64(base) + quint64(digit);
+    }
+
+    *result = value;
+    return true;
+}
+
+static bool isValidEscape(const char* pos, const char* end)
+{
+    switch (*pos) {
+    case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+        return true;
+    case 'u': {
+        char16_t codeUnit;
+        return readHex4(pos + 1,end,&codeUnit);
+    }
+    default:
+        return false;
+    }
+}
+
+QString FlatJsonField::toString() const
+{
+    if (m_array)
+        return QString();
+
+    if (!m_escaped)
+        return QString::fromUtf8(m_value,m_valueLength);
+
+    QString result;
+    result.reserve(m_valueLength);
+
+    const char* pos = m_value;
+    const char* end = m_value + m_valueLength;
+    const char* chunk = pos;
+    while (pos < end) {
+        if (*pos != '\\') {
+            pos++;
+            continue;
+        }
+
+        // Unescaped bytes before the escape sequence are UTF-8 encoded
+        result.append(QString::fromUtf8(chunk,int(pos - chunk)));
+        pos++;
+        if (pos == end)
+            break;
+
+        switch (*pos) {
+        case 'b': result.append(QLatin1Char('\b')); break;
+        case 'f': result.append(QLatin1Char('\f')); break;
+        case 'n': result.append(QLatin1Char('\n')); break;
+        case 'r': result.append(QLatin1Char('\r')); break;
+        case 't': result.append(QLatin1Char('\t')); break;
+        case 'u': {
+            // Escape sequences were validated by FlatJsonReader::readString
+            char16_t codeUnit = 0;
+            readHex4(pos + 1,end,&codeUnit);
+            result.append(QChar(codeUnit));
+            pos += 4;
+            break;
+        }
+        default:
+            // \" \\ and \/
+            result.append(QLatin1Char(*pos));
+        }
+        pos++;
+        chunk = pos;
+    }
+    result.append(QString::fromUtf8(chunk,int(end - chunk)));
+
+    return result;
+}
+
+QString FlatJsonField::toSharedString() const
+{
+    // Escaped values are rare, so they are not shared
+    if (m_pool == nullptr || m_escaped || m_array)
+        return toString();
+
+    return m_pool->intern(m_value,m_valueLength);
+}
+
+QStringList FlatJsonField::toStringList() const
+{
+    QStringList result;
+    if (!m_array)
+        return result;
+
+    // Array was already validated by FlatJsonReader::readStringArray
+    FlatJsonReader reader(m_value,m_value + m_valueLength);
+    reader.expect('[');
+    FlatJsonField item;
+    item.m_pool = m_pool;
+    while (reader.readString(&item.m_value,&item.m_valueLength,&item.m_escaped)) {
+        result.append(item.toSharedString());
+        reader.expect(',');
+    }
+
+    return result;
+}
+
+qint64 FlatJsonField::toLongLong(int base) const
+{
+    if (m_array)
+        return 0;
+    if (m_escaped)
+        return toString().toLongLong(nullptr,base);
+
+    bool negative = false;
+    quint64 magnitude = 0;
+    if (!parseNumber(m_value,m_value + m_valueLength,base,&negative,&magnitude))
+        return 0;
+
+    constexpr quint64 maxValue = quint64(std::numeric_limits<qint64>::max());
+    if (negative)
+        return (magnitude > maxValue + 1) ? 0 : qint64(0 - magnitude);
+
+    return (magnitude > maxValue) ? 0 : qint64(magnitude);
+}
+
+quint64 FlatJsonField::toULongLong(int base) const
+{
+    if (m_array)
+        return 0;
+    if (m_escaped)
+        return toString().toULongLong(nullptr,base);
+
+    bool negative = false;
+    quint64 result = 0;
+    if (!parseNumber(m_value,m_value + m_valueLength,base,&negative,&result) || (negative && result != 0))
+        return 0;
+
+    return result;
+}
+
+qint32 FlatJsonField::toInt(int base) const
+{
+    const qint64 value = toLongLong(base);
+    if (value < std::numeric_limits<qint32>::min() || value > std::numeric_limits<qint32>::max())
+        return 0;
+
+    return static_cast<qint32>(value);
+}
+
+quint32 FlatJsonField::toUInt(int base) const
+{
+    const quint64 value = toULongLong(base);
+    return (value > std::numeric_limits<quint32>::max()) ? 0 : static_cast<quint32>(value);
+}
+
+quint16 FlatJsonField::toUShort(int base) const
+{
+    const quint64 value = toULongLong(base);
+    return (value > std::numeric_limits<quint16>::max()) ? 0 : static_cast<quint16>(value);
+}
+
+double FlatJsonField::toDouble() const
+{
+    if (m_array)
+        return 0;
+
+    if (m_escaped)
+        return toString().toDouble();
+
+    // Value is wrapped without copying
+    return QByteArray::fromRawData(m_value,m_valueLength).toDouble();
+}
+
+/*
+ **********************************************************************************************************************
+ *
+ * FlatJsonReader
+ *
+ */
+
+FlatJsonReader::FlatJsonReader(const QByteArray& data) :
+    FlatJsonReader(data.constData(),data.constData() + data.size())
+{}
+
+FlatJsonReader::FlatJsonReader(const char* begin, const char* end) :
+    m_pos{begin},
+    m_end{end},
+    m_pool{nullptr},
+    m_firstRecord{true},
+    m_atEnd{false},
+    m_part{false}
+{}
+
+void FlatJsonReader::setFields(const QStringList& fields)
+{
+    m_fields.clear();
+    for (const QString& field : fields) {
+        const QByteArray key = field.toLatin1();
+        m_fields.append(flatJsonKeyHash(key.constData(),key.size()));
+    }
+}
+
+bool FlatJsonReader::readEnvelope()
+{
+    if (!expect('{'))
+        return false;
+
+    bool successful = false;
+    for (;;) {
+        const char* key;
+        int keyLength;
+        bool escaped;
+        if (!readString(&key,&keyLength,&escaped) || !expect(':'))
+            return false;
+
+        const QLatin1String keyString(key,keyLength);
+        if (keyString == QLatin1String("result"))
+            return successful && expect('[');
+
+        const char* value;
+        int valueLength;
+        if (!readString(&value,&valueLength,&escaped))
+            return false;
+
+        if (keyString == QLatin1String("status")) {
+            successful = (QLatin1String(value,valueLength) == QLatin1String("1"));
+            m_status.m_value = value;
+            m_status.m_valueLength = valueLength;
+            m_status.m_escaped = escaped;
+        } else if (keyString == QLatin1String("message")) {
+            m_message.m_value = value;
+            m_message.m_valueLength = valueLength;
+            m_message.m_escaped = escaped;
+        }
+
+        if (!expect(','))
+            return false;
+    }
+}
+
+QJsonObject FlatJsonReader::envelope() const
+{
+    QJsonObject result;
+    if (m_status.m_value != nullptr)
+        result.insert(QLatin1String("status"),m_status.toString());
+    if (m_message.m_value != nullptr)
+        result.insert(QLatin1String("message"),m_message.toString());
+    return result;
+}
+
+bool FlatJsonReader::readRecord(FlatJsonRecord* record)
+{
+    if (m_atEnd)
+        return false;
+
+    for (;;) {
+        skipWhitespace();
+        if (m_part && m_pos == m_end) {
+            m_atEnd = true;
+            return false;
+        }
+        if (m_pos < m_end && *m_pos == ']') {
+            m_pos++;
+            m_atEnd = readEnvelopeEnd();
+            return false;
+        }
+
+        if (!m_firstRecord && !expect(','))
+            return false;
+        m_firstRecord = false;
+
+        bool accepted = false;
+        if (!readObject(record,&accepted))
+            return false;
+        if (accepted)
+            return true;
+    }
+}
+
+bool FlatJsonReader::readObject(FlatJsonRecord* record, bool* accepted)
+{
+    if (!expect('{'))
+        return false;
+
+    record->clear();
+    int matchedConditions = 0;
+    bool rejected = false;
+
+    skipWhitespace();
+    if (m_pos < m_end && *m_pos == '}') {
+        m_pos++;
+        *accepted = m_filter.isEmpty();
+        return true;
+    }
+
+    for (;;) {
+        FlatJsonField field;
+        bool keyEscaped;
+        if (!readString(&field.m_key,&field.m_keyLength,&keyEscaped) || keyEscaped || !expect(':'))
+            return false;
+
+        // Only strings and arrays of strings are expected, anything else is handled by QJsonDocument
+        skipWhitespace();
+        field.m_array = (m_pos < m_end && *m_pos == '[');
+        const bool valueRead = field.m_array ? readStringArray(&field.m_value,&field.m_valueLength,&field.m_escaped)
+                                             : readString(&field.m_value,&field.m_valueLength,&field.m_escaped);
+        if (!valueRead)
+            return false;
+
+        field.m_keyHash = flatJsonKeyHash(field.m_key,field.m_keyLength);
+        field.m_pool = m_pool;
+
+        // Rest of the rejected object is only scanned
+        if (!rejected && !m_filter.isEmpty()) {
+            const int matched = matchFilter(field);
+            if (matched < 0)
+                rejected = true;
+            else
+                matchedConditions += matched;
+        }
+
+        if (!rejected && !isSkipped(field.m_keyHash))
+            record->append(field);
+
+        skipWhitespace();
+        if (m_pos == m_end)
+            return false;
+        if (*m_pos == '}') {
+            m_pos++;
+            *accepted = !rejected && matchedConditions == m_filter.conditionCount();
+            return true;
+        }
+        if (*m_pos++ != ',')
+            return false;
+    }
+}
+
+int FlatJsonReader::countRecords() const
+{
+    return scanRecords(nullptr);
+}
+
+QVector<const char*> FlatJsonReader::recordStarts() const
+{
+    QVector<const char*> starts;
+    scanRecords(&starts);
+    return starts;
+}
+
+QVector<FlatJsonReader> FlatJsonReader::split(const QVector<const char*>& starts, int count) const
+{
+    QVector<FlatJsonReader> result;
+
+    const int recordCount = starts.size();
+    if (recordCount == 0 || count < 1)
+        return result;
+
+    count = qMin(count,recordCount);
+    result.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const int first = int(qint64(recordCount) * i / count);
+        const int last = int(qint64(recordCount) * (i + 1) / count);
+
+        FlatJsonReader part(*this);
+        part.m_pos = starts.at(first);
+        part.m_firstRecord = true;
+        part.m_atEnd = false;
+
+        // Part ends at the comma, which separates its last object from the first object of the next part. Last part
+        // reads up to the end of the array, same as the whole reader would do.
+        if (last < recordCount) {
+            const char* end = starts.at(last) - 1;
+            while (end > starts.at(first) && isJsonWhitespace(*end))
+                end--;
+            if (*end != ',')
+                return QVector<FlatJsonReader>();
+
+            part.m_end = end;
+            part.m_part = true;
+        }
+
+        result.append(part);
+    }
+
+    return result;
+}
+
+int FlatJsonReader::scanRecords(QVector<const char*>* starts) const
+{
+    int count = 0;
+    int depth = 0;
+    for (const char* pos = m_pos; pos < m_end; pos++) {
+        switch (*pos) {
+        case '"':
+            // Braces inside of the strings are skipped
+            for (pos++; pos < m_end && *pos != '"'; pos++) {
+                if (*pos == '\\')
+                    pos++;
+            }
+            break;
+        case '{':
+            if (depth == 0) {
+                count++;
+                if (starts)
+                    starts->append(pos);
+            }
+            depth++;
+            break;
+        case '[':
+            depth++;
+            break;
+        case '}':
+            depth--;
+            break;
+        case ']':
+            if (depth == 0)
+                return count;
+            depth--;
+            break;
+        }
+    }
+
+    return count;
+}
+
+bool FlatJsonReader::readEnvelopeEnd()
+{
+    // Anything after the "result" array (e.g. other members of the reply) is left to QJsonDocument
+    if (!expect('}'))
+        return false;
+
+    skipWhitespace();
+    return m_pos == m_end;
+}
+
+bool FlatJsonReader::readString(const char** begin, int* length, bool* escaped)
+{
+    if (!expect('"'))
+        return false;
+
+    *begin = m_pos;
+    *escaped = false;
+    while (m_pos < m_end) {
+        switch (*m_pos) {
+        case '"':
+            *length = int(m_pos - *begin);
+            m_pos++;
+            return true;
+        case '\\':
+            // Malformed escape sequences are reported by QJsonDocument, so such replies are not read here
+            if (m_pos + 1 == m_end || !isValidEscape(m_pos + 1,m_end))
+                return false;
+            *escaped = true;
+            m_pos += (m_pos[1] == 'u') ? 6 : 2;
+            break;
+        default:
+            m_pos++;
+        }
+    }
+
+    return false;
+}
+
+bool FlatJsonReader::readStringArray(const char** begin, int* length, bool* escaped)
+{
+    skipWhitespace();
+    *begin = m_pos;
+    *escaped = false;
+    if (!expect('['))
+        return false;
+
+    skipWhitespace();
+    if (m_pos < m_end && *m_pos == ']') {
+        m_pos++;
+        *length = int(m_pos - *begin);
+        return true;
+    }
+
+    for (;;) {
+        const char* item;
+        int itemLength;
+        bool itemEscaped;
+        if (!readString(&item,&itemLength,&itemEscaped))
+            return false;
+
+        skipWhitespace();
+        if (m_pos == m_end)
+            return false;
+        if (*m_pos == ']') {
+            m_pos++;
+            *length = int(m_pos - *begin);
+            return true;
+        }
+        if (*m_pos++ != ',')
+            return false;
+    }
+}
+
+bool FlatJsonReader::isSkipped(quint64 keyHash) const
+{
+    if (m_fields.isEmpty())
+        return false;
+
+    for (quint64 field : m_fields) {
+        if (field == keyHash)
+            return false;
+    }
+    return true;
+}
+
+int FlatJsonReader::matchFilter(const FlatJsonField& field) const
+{
+    int matched = 0;
+    for (int i = 0; i < m_filter.conditionCount(); i++) {
+        if (m_filter.keyHash(i) != field.m_keyHash || field.key() != m_filter.field(i))
+            continue;
+
+        // Conditions are checked on the raw bytes, only escaped values have to be decoded first
+        bool matches = false;
+        if (field.m_array) {
+            // Arrays never match
+        } else if (field.m_escaped) {
+            const QByteArray value = field.toString().toUtf8();
+            matches = m_filter.matches(i,value.constData(),value.size());
+        } else {
+            matches = m_filter.matches(i,field.m_value,field.m_valueLength);
+        }
+
+        if (!matches)
+            return -1;
+        matched++;
+    }
+    return matched;
+}
+
+bool FlatJsonReader::expect(char c)
+{
+    skipWhitespace();
+    if (m_pos == m_end || *m_pos != c)
+        return false;
+
+    m_pos++;
+    return true;
+}
+
+void FlatJsonReader::skipWhitespace()
+{
+    while (m_pos < m_end && isJsonWhitespace(*m_pos))
+        m_pos++;
+}
+
+} //namespace QtEtherscan
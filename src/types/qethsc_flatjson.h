@@ -0,0 +1,299 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_FLATJSON_H
+#define QT_ETHERSCAN_FLATJSON_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QVector>
+
+#include <type_traits>
+
+#include "../qethsc_paralleldecoding.h"
+#include "./qethsc_jsonobjectslist.h"
+#include "./qethsc_recordfilter.h"
+#include "./qethsc_stringpool.h"
+
+namespace QtEtherscan {
+
+/*! @brief Returns 64-bit FNV-1a hash of the JSON key. It is used to dispatch fields of FlatJsonRecord in switch
+ *         statements (duplicate hashes of known keys are reported by compiler as duplicate case labels). Hash is not
+ *         unique for unknown keys, so the key itself is compared within the selected case. */
+constexpr quint64 flatJsonKeyHash(const char* key, int length)
+{
+    quint64 hash = 14695981039346656037ull;
+    for (int i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr quint64 flatJsonKeyHash(const char* key)
+{
+    int length = 0;
+    while (key[length] != '\0')
+        length++;
+    return flatJsonKeyHash(key,length);
+}
+
+/*! @class FlatJsonField src/types/qethsc_flatjson.h
+ *  @brief Object of this class represents single "key":"value" pair of the flat JSON object read by FlatJsonReader.
+ *         Value is a string or an array of strings. Object points into the reply data and decodes value directly from
+ *         its UTF-8 bytes. For internal use only. */
+
+class FlatJsonField
+{
+public:
+    FlatJsonField() :
+        m_key{nullptr},m_keyLength{0},m_keyHash{0},m_value{nullptr},m_valueLength{0},m_escaped{false},m_array{false},
+        m_pool{nullptr} {}
+
+    /*! @brief Returns hash of the key, which can be compared with flatJsonKeyHash("key"). */
+    quint64        keyHash() const                         { return m_keyHash; }
+    QLatin1String  key() const                             { return QLatin1String(m_key,m_keyLength); }
+
+    /*! @brief Returns true if value is an array of strings. Objects skip array values of their string and number
+     *         fields, so such fields get the same defaults as when they are read from QJsonObject. */
+    bool           isArray() const                         { return m_array; }
+
+    /*! @brief Returns true if value has JSON escape sequences, so its raw bytes differ from the decoded value. */
+    bool           isEscaped() const                       { return m_escaped; }
+
+    /*! @brief Returns raw UTF-8 bytes of the value without quotes. Bytes are not null-terminated. */
+    const char*    rawValue() const                        { return m_value; }
+    int            rawValueLength() const                  { return m_valueLength; }
+
+    /*! @brief Returns value as QString. JSON escape sequences are decoded. For arrays empty QString is returned. */
+    QString        toString() const;
+
+    /*! @brief Same as toString, but if reader has StringPool - returned string is shared with other equal values
+     *         read. Used for the values, which repeat from row to row. */
+    QString        toSharedString() const;
+
+    /*! @brief Returns array value as QStringList. For string values empty QStringList is returned. Items are shared
+     *         via StringPool of the reader, if it has one. */
+    QStringList    toStringList() const;
+
+    /*! @brief Returns value as number. Value is converted in the same way as by QString::toLongLong and other
+     *         QString methods: base 0 means C language convention, if value is not a number or does not fit into
+     *         the type - 0 is returned. */
+    qint64         toLongLong(int base = 10) const;
+    quint64        toULongLong(int base = 10) const;
+    qint32         toInt(int base = 10) const;
+    quint32        toUInt(int base = 10) const;
+    quint16        toUShort(int base = 10) const;
+
+    /*! @brief Returns value as double. If value is not a number - 0 is returned. */
+    double         toDouble() const;
+
+private:
+    friend class FlatJsonReader;
+
+    const char*    m_key;
+    int            m_keyLength;
+    quint64        m_keyHash;
+    const char*    m_value;
+    int            m_valueLength;
+    bool           m_escaped;
+    bool           m_array;
+    StringPool*    m_pool;
+};
+
+/*! @typedef FlatJsonRecord
+ *  @brief Fields of the single flat JSON object. */
+
+typedef QVarLengthArray<FlatJsonField,32> FlatJsonRecord;
+
+/*! @class FlatJsonReader src/types/qethsc_flatjson.h
+ *  @brief This class reads successful etherscan.io replies, which have array of flat objects with string values as
+ *         a result (e.g. replies of txlist, tokentx and getLogs actions). Such replies are read without building
+ *         QJsonDocument. Anything unusual (unsuccessful reply, numbers, nested objects or arrays of anything but
+ *         strings) is reported as failure, so caller can fall back to QJsonDocument. Reader does not copy
+ *         data, so it must outlive the reader and all records read. For internal use only. */
+
+class FlatJsonReader
+{
+public:
+    explicit FlatJsonReader(const QByteArray& data);
+
+    /*! @brief Limits fields of the records to the specified ones. Other fields are skipped without decoding. If
+     *         fields is empty - all fields are read. */
+    void           setFields(const QStringList& fields);
+
+    /*! @brief Sets filter, which is checked against raw values of the fields. Objects, which do not match the filter,
+     *         are skipped by readRecord. Filter is checked before fields are limited by setFields, so it can use
+     *         fields which are not read. */
+    void           setFilter(const RecordFilter& filter)   { m_filter = filter; }
+
+    /*! @brief Sets StringPool, which is used by FlatJsonField::toSharedString of the fields read. Can be nullptr. */
+    void           setStringPool(StringPool* pool)         { m_pool = pool; }
+
+    /*! @brief Reads reply up to the first element of its "result" array. Returns false if reply is not successful
+     *         ("status" is not "1") or has unexpected structure. */
+    bool           readEnvelope();
+
+    /*! @brief Returns "status" and "message" of the reply read by readEnvelope, so they can be checked in the same
+     *         way as ones of the QJsonDocument. */
+    QJsonObject    envelope() const;
+
+    /*! @brief Reads next object of the "result" array. Returns false when array is finished or when unexpected data
+     *         was met. In the first case atEnd() returns true. Array is finished only if nothing but the end of the
+     *         reply follows it. */
+    bool           readRecord(FlatJsonRecord* record);
+
+    /*! @brief Returns number of objects left in the "result" array. Data is only scanned, nothing is decoded or
+     *         allocated, so containers can be reserved before the objects are read. */
+    int            countRecords() const;
+
+    /*! @brief Same as countRecords, but returns positions of the objects left in the "result" array. Their number can
+     *         be used to reserve containers and positions - to split the array with split method. */
+    QVector<const char*> recordStarts() const;
+
+    /*! @brief Splits rest of the "result" array, objects of which start at the positions returned by recordStarts,
+     *         into count parts with equal number of objects. Every part is a reader with the same settings, which reads
+     *         its objects and reports atEnd() after the last one, so parts can be read by different threads. Last part
+     *         also checks the end of the array and of the reply. Returns empty QVector if array is malformed. */
+    QVector<FlatJsonReader> split(const QVector<const char*>& starts, int count) const;
+
+    /*! @brief Returns true if whole "result" array was read. */
+    bool           atEnd() const                           { return m_atEnd; }
+
+private:
+    friend class FlatJsonField;
+
+    FlatJsonReader(const char* begin, const char* end);
+
+    int            scanRecords(QVector<const char*>* starts) const;
+    bool           readEnvelopeEnd();
+    bool           readObject(FlatJsonRecord* record, bool* accepted);
+    bool           readString(const char** begin, int* length, bool* escaped);
+    bool           readStringArray(const char** begin, int* length, bool* escaped);
+    bool           isSkipped(quint64 keyHash) const;
+    int            matchFilter(const FlatJsonField& field) const;
+    bool           expect(char c);
+    void           skipWhitespace();
+
+    const char*    m_pos;
+    const char*    m_end;
+    FlatJsonField  m_status;
+    FlatJsonField  m_message;
+    QVarLengthArray<quint64,16> m_fields;
+    RecordFilter   m_filter;
+    StringPool*    m_pool;
+    bool           m_firstRecord;
+    bool           m_atEnd;
+    bool           m_part;
+};
+
+/*! @brief This trait tells if list of type L can be decoded by FlatJsonReader. This is true for JsonObjectsList of
+ *         classes having constructor taking FlatJsonRecord. */
+template<class L>
+struct FlatJsonDecodable : std::false_type {};
+
+template<class C>
+struct FlatJsonDecodable<JsonObjectsList<C>> : std::is_constructible<C,const FlatJsonRecord&> {};
+
+/*! @brief Reads objects left in the "result" array of the reader into list. Returns true if whole array was read.
+ *         For internal use only. */
+template<class C>
+bool readFlatJsonRecords(FlatJsonReader* reader, JsonObjectsList<C>* list)
+{
+    FlatJsonRecord record;
+    while (reader->readRecord(&record))
+        list->emplaceBack(record);
+
+    return reader->atEnd();
+}
+
+/*! @brief Decodes successful reply with array of flat objects into list. If fields is not empty - only these fields
+ *         are decoded, others are left default in the resulting objects. Objects, which do not match filter, are
+ *         not created at all. If pool is not nullptr - repeating values of the objects are shared via it. If
+ *         envelope is not nullptr - it receives "status" and "message" of the reply. Returns false if reply can not
+ *         be decoded this way, list and envelope are not modified in such case. */
+template<class C>
+bool decodeFlatJsonList(const QByteArray& data, JsonObjectsList<C>* list, const QStringList& fields = QStringList(),
+                        const RecordFilter& filter = RecordFilter(), StringPool* pool = nullptr,
+                        QJsonObject* envelope = nullptr)
+{
+    FlatJsonReader reader(data);
+    reader.setFields(fields);
+    reader.setFilter(filter);
+    reader.setStringPool(pool);
+    if (!reader.readEnvelope())
+        return false;
+
+    JsonObjectsList<C> result;
+    if (pool == nullptr && ParallelDecoding::maxThreads() > 1) {
+        // Array is scanned once: positions of the objects tell if it is large enough to be split and where to split it
+        const QVector<const char*> starts = reader.recordStarts();
+        if (filter.isEmpty())
+            result.reserve(starts.size());
+
+        if (ParallelDecoding::isEnabledFor(starts.size())) {
+            const QVector<FlatJsonReader> parts = reader.split(starts,ParallelDecoding::chunkCount(starts.size()));
+            if (parts.isEmpty())
+                return false;
+
+            QVector<JsonObjectsList<C>> partResults(parts.size());
+            QVector<int> partsRead(parts.size(),0);
+            JsonObjectsList<C>* partResultsData = partResults.data();
+            int* partsReadData = partsRead.data();
+            ParallelDecoding::forEach(parts.size(),[&parts,partResultsData,partsReadData](int index) {
+                FlatJsonReader part = parts.at(index);
+                partsReadData[index] = readFlatJsonRecords(&part,&partResultsData[index]) ? 1 : 0;
+            });
+
+            if (partsRead.contains(0))
+                return false;
+
+            for (JsonObjectsList<C>& partResult : partResults) {
+                for (C& element : partResult)
+                    result.emplaceBack(std::move(element));
+            }
+        } else if (!readFlatJsonRecords(&reader,&result)) {
+            return false;
+        }
+    } else {
+        // StringPool is not thread-safe, so such lists are decoded on the calling thread. With filter most of the
+        // objects may be dropped, so array is not scanned in advance and storage grows as needed.
+        if (filter.isEmpty())
+            result.reserve(reader.countRecords());
+        if (!readFlatJsonRecords(&reader,&result))
+            return false;
+    }
+
+    list->swap(result);
+    if (envelope)
+        *envelope = reader.envelope();
+    return true;
+}
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_FLATJSON_H
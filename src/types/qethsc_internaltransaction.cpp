@@ -50,4 +50,73 @@ InternalTransaction::InternalTransaction(const QJsonObject& jsonObject) :
     m_errCodeString     {jsonObject.value("errCode").toString()                                         }
 {}
 
+InternalTransaction::InternalTransaction(const FlatJsonRecord& record) :
+    InternalTransaction()
+{
+    for (const FlatJsonField& field : record) {
+        if (field.isArray())
+            continue;
+
+        // Hash only selects the candidate member, key is compared to ignore unknown keys with colliding hashes
+        switch (field.keyHash()) {
+        case flatJsonKeyHash("blockNumber"):
+            if (field.key() == QLatin1String("blockNumber"))
+                m_blockNumber = field.toInt();
+            break;
+        case flatJsonKeyHash("timeStamp"):
+            if (field.key() == QLatin1String("timeStamp"))
+                m_timeStamp = field.toLongLong();
+            break;
+        case flatJsonKeyHash("hash"):
+            if (field.key() == QLatin1String("hash"))
+                m_hash = field.toSharedString();
+            break;
+        case flatJsonKeyHash("from"):
+            if (field.key() == QLatin1String("from"))
+                m_from = field.toSharedString();
+            break;
+        case flatJsonKeyHash("to"):
+            if (field.key() == QLatin1String("to"))
+                m_to = field.toSharedString();
+            break;
+        case flatJsonKeyHash("value"):
+            if (field.key() == QLatin1String("value"))
+                m_value = field.toString();
+            break;
+        case flatJsonKeyHash("contractAddress"):
+            if (field.key() == QLatin1String("contractAddress"))
+                m_contractAddress = field.toSharedString();
+            break;
+        case flatJsonKeyHash("input"):
+            if (field.key() == QLatin1String("input"))
+                m_input = field.toString();
+            break;
+        case flatJsonKeyHash("type"):
+            if (field.key() == QLatin1String("type"))
+                m_typeString = field.toSharedString();
+            break;
+        case flatJsonKeyHash("gas"):
+            if (field.key() == QLatin1String("gas"))
+                m_gas = field.toULongLong();
+            break;
+        case flatJsonKeyHash("gasUsed"):
+            if (field.key() == QLatin1String("gasUsed"))
+                m_gasUsed = field.toULongLong();
+            break;
+        case flatJsonKeyHash("traceId"):
+            if (field.key() == QLatin1String("traceId"))
+                m_traceIdString = field.toSharedString();
+            break;
+        case flatJsonKeyHash("isError"):
+            if (field.key() == QLatin1String("isError"))
+                m_isErrorString = field.toSharedString();
+            break;
+        case flatJsonKeyHash("errCode"):
+            if (field.key() == QLatin1String("errCode"))
+                m_errCodeString = field.toSharedString();
+            break;
+        }
+    }
+}
+
 } //namespace QtEtherscan
@@ -30,6 +30,7 @@
 
 #include "./qethsc_ether.h"
 #include "./qethsc_constants.h"
+#include "./qethsc_flatjson.h"
 #include "./qethsc_jsonobjectslist.h"
 
 namespace QtEtherscan {
@@ -50,6 +51,10 @@ public:
     InternalTransaction(const QJsonValue& jsonValue) :
         InternalTransaction(jsonValue.toObject()) {}
 
+    /*! @brief Constructs InternalTransaction object from the record read by FlatJsonReader. Gives the same result as
+     *         constructor taking QJsonObject, but values are decoded directly from the reply data. */
+    InternalTransaction(const FlatJsonRecord& record);
+
     /*! @brief Returns true if this InternalTransaction object is valid and contains reasonable information. InternalTransaction
      *         object is considered to be valid if blockNumber() contains anything but not -1. */
     bool      isValid() const          { return m_blockNumber != InvalidBlockNumber; }
@@ -97,6 +102,8 @@ public:
     QString   errCodeString() const    { return m_errCodeString; }
 
 private:
+    friend class InternalTransactionColumns;
+
     qint32    m_blockNumber;
     qint64    m_timeStamp;
     QString   m_hash;
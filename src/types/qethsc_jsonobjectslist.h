@@ -26,13 +26,18 @@
 #define QT_ETHERSCAN_JSONOBJECTSLIST_H
 
 #include <QList>
+#include <QVector>
 #include <QJsonArray>
 #include <QJsonValue>
 
+#include <utility>
+
+#include "../qethsc_paralleldecoding.h"
+
 namespace QtEtherscan {
 
 /*! @class JsonObjectsList src/types/qethsc_jsonobjectslist.h
- *  @brief This is nothing more but a QList with some extra constructors.
+ *  @brief This is nothing more but a QList with some extra constructors and emplacement.
  *  @details This class is needed to simplify creating collections of objects, which are returned by etherscam.io
  *           in JSON-serialized form. */
 
@@ -44,11 +49,30 @@ public:
     JsonObjectsList() :
         QList<C>() {}
 
+    /*! @brief Takes elements of the QList without copying them. */
+    JsonObjectsList(QList<C>&& list) :
+        QList<C>(std::move(list)) {}
+
     /*! @brief Takes QJsonArray as an argument, and populates this JsonObjectsList by JSON-serialized objects stored
-     *         in QJsonArray. */
+     *         in QJsonArray. Large arrays are decoded in parallel, if it is enabled by ParallelDecoding. */
     JsonObjectsList(const QJsonArray& jsonArray) {
+        this->reserve(jsonArray.size());
+        if (ParallelDecoding::isEnabledFor(jsonArray.size())) {
+            // Array is only read by the threads, every thread writes own range of the elements
+            QVector<C> elements(jsonArray.size());
+            C* data = elements.data();
+            ParallelDecoding::forEachChunk(jsonArray.size(),[&jsonArray,data](int begin, int end) {
+                for (int i = begin; i < end; i++)
+                    data[i] = C(jsonArray.at(i));
+            });
+
+            for (C& element : elements)
+                emplaceBack(std::move(element));
+            return;
+        }
+
         for (const QJsonValue& jsonValue : jsonArray)
-            this->append(C(jsonValue));
+            emplaceBack(jsonValue);
     }
 
     /*! @brief Takes QJsonValue as an argument, converts it to QJsonArray and populates this JsonObjectsList by
@@ -56,6 +80,18 @@ public:
      *         constructor will create empty JsonObjectsList. */
     JsonObjectsList(const QJsonValue& jsonValue) :
         JsonObjectsList(jsonValue.toArray()) {}
+
+    /*! @brief Constructs new element at the end of this list from the arguments and returns reference to it. With
+     *         Qt 6 this is QList::emplaceBack, with Qt 5 element is constructed and appended to the QList. */
+    template<class... Args>
+    C& emplaceBack(Args&&... args) {
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        return QList<C>::emplaceBack(std::forward<Args>(args)...);
+#else
+        this->append(C(std::forward<Args>(args)...));
+        return this->last();
+#endif
+    }
 };
 
 } //namespace QtEtherscan
@@ -0,0 +1,123 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_recordfilter.h"
+
+#include "qethsc_flatjson.h"
+
+#include <cstring>
+
+namespace QtEtherscan {
+
+static char toLowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+static bool equalsIgnoreCase(const char* value, const char* expected, int length)
+{
+    for (int i = 0; i < length; i++) {
+        if (toLowerAscii(value[i]) != toLowerAscii(expected[i]))
+            return false;
+    }
+    return true;
+}
+
+// Compares non-negative decimal numbers of any length. Returns false if value is not a decimal number.
+static bool compareDecimal(const char* value, int length, const QByteArray& expected, int* result)
+{
+    if (length == 0)
+        return false;
+    for (int i = 0; i < length; i++) {
+        if (value[i] < '0' || value[i] > '9')
+            return false;
+    }
+
+    while (length > 1 && value[0] == '0') {
+        value++;
+        length--;
+    }
+
+    const char* other = expected.constData();
+    int otherLength = expected.size();
+    while (otherLength > 1 && other[0] == '0') {
+        other++;
+        otherLength--;
+    }
+
+    if (length != otherLength) {
+        *result = (length < otherLength) ? -1 : 1;
+        return true;
+    }
+
+    const int compared = std::memcmp(value,other,size_t(length));
+    *result = (compared < 0) ? -1 : (compared > 0 ? 1 : 0);
+    return true;
+}
+
+RecordFilter& RecordFilter::addCondition(const QString& field, Comparison comparison, const QString& value)
+{
+    const QByteArray key = field.toLatin1();
+    m_conditions.append({ field, flatJsonKeyHash(key.constData(),key.size()), comparison, value.toUtf8() });
+    return *this;
+}
+
+bool RecordFilter::matches(int index, const char* value, int length) const
+{
+    const Condition& condition = m_conditions.at(index);
+    const QByteArray& expected = condition.value;
+
+    int compared = 0;
+    switch (condition.comparison) {
+    case Equal:
+        return length == expected.size() && equalsIgnoreCase(value,expected.constData(),length);
+    case NotEqual:
+        return length != expected.size() || !equalsIgnoreCase(value,expected.constData(),length);
+    case StartsWith:
+        return length >= expected.size() && equalsIgnoreCase(value,expected.constData(),expected.size());
+    case GreaterOrEqual:
+        return compareDecimal(value,length,expected,&compared) && compared >= 0;
+    case LessOrEqual:
+        return compareDecimal(value,length,expected,&compared) && compared <= 0;
+    }
+
+    return false;
+}
+
+bool RecordFilter::accepts(const QJsonObject& object) const
+{
+    for (int i = 0; i < m_conditions.count(); i++) {
+        const QJsonValue value = object.value(m_conditions.at(i).field);
+        if (!value.isString())
+            return false;
+
+        const QByteArray data = value.toString().toUtf8();
+        if (!matches(i,data.constData(),data.size()))
+            return false;
+    }
+
+    return true;
+}
+
+} //namespace QtEtherscan
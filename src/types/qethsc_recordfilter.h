@@ -0,0 +1,102 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_RECORDFILTER_H
+#define QT_ETHERSCAN_RECORDFILTER_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+namespace QtEtherscan {
+
+/*! @class RecordFilter src/types/qethsc_recordfilter.h
+ *  @brief Object of this class holds conditions on the raw field values of list replies (e.g. of txlist or tokentx
+ *         actions). Conditions are checked while reply is decoded, so objects which do not match are never created.
+ *  @details All conditions must be met for the object to be accepted. If field is missing in the object - condition
+ *           is not met. Equal, NotEqual and StartsWith compare strings ignoring case of ASCII letters, so hex addresses
+ *           can be passed in any case. GreaterOrEqual and LessOrEqual compare non-negative decimal numbers of any
+ *           length, so they can be used with wei values, which do not fit into 64-bit integers.
+ *  @code
+ *  QtEtherscan::RecordFilter filter;
+ *  filter.addCondition("isError",QtEtherscan::RecordFilter::Equal,"0")
+ *        .addCondition("methodId",QtEtherscan::RecordFilter::Equal,"0xa9059cbb")
+ *        .addCondition("value",QtEtherscan::RecordFilter::GreaterOrEqual,"1000000000000000000");
+ *
+ *  QtEtherscan::RequestScope scope(&etherscan);
+ *  scope.setRecordFilter(filter);
+ *  QtEtherscan::TransactionList transactions =
+ *      etherscan.getListOfNomalTransactions(address,0,99999999,1,10000,QtEtherscan::Asc);
+ *  @endcode */
+
+class RecordFilter
+{
+public:
+    enum Comparison {
+        Equal,
+        NotEqual,
+        StartsWith,
+        GreaterOrEqual,
+        LessOrEqual
+    };
+
+    RecordFilter() {}
+
+    /*! @brief Adds condition on the field. Returns reference to this object, so calls can be chained. */
+    RecordFilter&  addCondition(const QString& field, Comparison comparison, const QString& value);
+
+    /*! @brief Returns true if no conditions were added. */
+    bool           isEmpty() const                         { return m_conditions.isEmpty(); }
+
+    /*! @brief Returns number of conditions. */
+    int            conditionCount() const                  { return m_conditions.count(); }
+
+    /*! @brief Returns hash of the field of the condition at index - same as flatJsonKeyHash of the field name. */
+    quint64        keyHash(int index) const                { return m_conditions.at(index).keyHash; }
+
+    /*! @brief Returns name of the field of the condition at index. */
+    QString        field(int index) const                  { return m_conditions.at(index).field; }
+
+    /*! @brief Returns true if raw UTF-8 value of the field matches condition at index. */
+    bool           matches(int index, const char* value, int length) const;
+
+    /*! @brief Returns true if JSON object meets all conditions. Used for replies, which are decoded with
+     *         QJsonDocument. */
+    bool           accepts(const QJsonObject& object) const;
+
+private:
+    struct Condition {
+        QString    field;
+        quint64    keyHash;
+        Comparison comparison;
+        QByteArray value;
+    };
+
+    QList<Condition> m_conditions;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_RECORDFILTER_H
@@ -0,0 +1,47 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "qethsc_stringpool.h"
+
+namespace QtEtherscan {
+
+QString StringPool::intern(const char* data, int length)
+{
+    // Lookup does not copy the data, key is copied only when new string is added
+    const QHash<QByteArray,QString>::const_iterator it = m_strings.constFind(QByteArray::fromRawData(data,length));
+    if (it != m_strings.constEnd())
+        return it.value();
+
+    const QString result = QString::fromUtf8(data,length);
+    m_strings.insert(QByteArray(data,length),result);
+    return result;
+}
+
+QString StringPool::intern(const QString& string)
+{
+    const QByteArray data = string.toUtf8();
+    return intern(data.constData(),data.size());
+}
+
+} //namespace QtEtherscan
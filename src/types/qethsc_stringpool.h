@@ -0,0 +1,74 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef QT_ETHERSCAN_STRINGPOOL_H
+#define QT_ETHERSCAN_STRINGPOOL_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+
+namespace QtEtherscan {
+
+/*! @class StringPool src/types/qethsc_stringpool.h
+ *  @brief Object of this class holds single instance of every string passed to it. Decoders of list replies use it
+ *         for the values, which repeat from row to row (addresses, token names and symbols, block hashes), so all
+ *         equal values share one implicitly shared QString instead of allocating their own.
+ *  @details Strings returned by the pool stay valid after the pool is destroyed or cleared. Equal strings returned
+ *           by the same pool have the same data, so they can be compared with QString::constData() first. StringPool
+ *           is not thread-safe. Use RequestScope to make API object use the pool.
+ *  @code
+ *  QtEtherscan::StringPool pool;
+ *  QtEtherscan::RequestScope scope(&etherscan);
+ *  scope.setStringPool(&pool);
+ *  for (int page = 1; page <= 10; page++)
+ *      history.append(etherscan.getListOfNomalTransactions(address,0,99999999,page,10000,QtEtherscan::Asc));
+ *  @endcode */
+
+class StringPool
+{
+public:
+    StringPool() {}
+
+    /*! @brief Returns shared instance of UTF-8 string. */
+    QString        intern(const char* data, int length);
+
+    /*! @brief Returns shared instance of string. */
+    QString        intern(const QString& string);
+
+    /*! @brief Returns number of distinct strings in this pool. */
+    int            count() const                           { return m_strings.count(); }
+
+    /*! @brief Removes all strings from this pool. Strings, which were returned before, are not affected. */
+    void           clear()                                 { m_strings.clear(); }
+
+private:
+    Q_DISABLE_COPY(StringPool)
+
+    QHash<QByteArray,QString> m_strings;
+};
+
+} //namespace QtEtherscan
+
+#endif // QT_ETHERSCAN_STRINGPOOL_H
@@ -30,6 +30,7 @@
 
 #include "./qethsc_ether.h"
 #include "./qethsc_constants.h"
+#include "./qethsc_flatjson.h"
 #include "./qethsc_jsonobjectslist.h"
 
 namespace QtEtherscan {
@@ -48,6 +49,10 @@ public:
     Transaction(const QJsonValue& jsonValue) :
         Transaction(jsonValue.toObject()) {}
 
+    /*! @brief Constructs Transaction object from the record read by FlatJsonReader. Gives the same result as
+     *         constructor taking QJsonObject, but values are decoded directly from the reply data. */
+    Transaction(const FlatJsonRecord& record);
+
     /*! @brief Returns true if this Transaction object is valid and contains reasonable information. Transaction object
      *         is considered to be valid if blockNumber() contains anything but not -1. */
     bool      isValid() const               { return m_blockNumber != InvalidBlockNumber; }
@@ -113,6 +118,8 @@ public:
     QString   functionName() const          { return m_functionName; }
 
 private:
+    friend class TransactionColumns;
+
     qint32    m_blockNumber;
     qint64    m_timeStamp;
     QString   m_hash;
@@ -0,0 +1,12 @@
+QT += core
+QT -= gui
+
+TARGET = flatjson
+CONFIG += console
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+SOURCES += main.cpp
+
+include(../../QtEtherscan.pri)
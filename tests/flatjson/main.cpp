@@ -0,0 +1,161 @@
+/*
+ **********************************************************************************************************************
+ *
+ * QtEtherscan
+ * Copyright (C) 2022-2024 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of QtEtherscan
+ *
+ * QtEtherscan is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * QtEtherscan  is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with QtEtherscan; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+/*! @file tests/flatjson/main.cpp
+ *  @brief This test checks that records decoded directly from the reply data (FlatJsonReader) are the same as records
+ *         decoded with QJsonDocument. */
+
+#include <QCoreApplication>
+
+#include <QDebug>
+#include <QJsonDocument>
+#include <QVariant>
+
+#include "QtEtherscan.h"
+
+using namespace QtEtherscan;
+
+static int failures = 0;
+
+static void compare(const char* test, const char* field, const QVariant& flat, const QVariant& json)
+{
+    if (flat == json)
+        return;
+
+    qWarning().nospace() << test << ": " << field << " differs, flat=" << flat << " json=" << json;
+    failures++;
+}
+
+static QByteArray reply(const QByteArray& records)
+{
+    return QByteArray(R"({"status":"1","message":"OK","result":[)") + records + QByteArray("]}");
+}
+
+static void compareTransactions(const char* test, const QByteArray& records)
+{
+    const QByteArray data = reply(records);
+
+    TransactionList flatList;
+    if (!decodeFlatJsonList(data,&flatList)) {
+        qWarning().nospace() << test << ": reply was not decoded by FlatJsonReader";
+        failures++;
+        return;
+    }
+    const TransactionList jsonList(QJsonDocument::fromJson(data).object().value("result"));
+
+    compare(test,"count",flatList.count(),jsonList.count());
+    for (int i = 0; i < qMin(flatList.count(),jsonList.count()); i++) {
+        Transaction flat = flatList.at(i);
+        Transaction json = jsonList.at(i);
+
+        compare(test,"blockNumber",flat.blockNumber(),json.blockNumber());
+        compare(test,"timeStamp",flat.timeStamp(),json.timeStamp());
+        compare(test,"hash",flat.hash(),json.hash());
+        compare(test,"nonce",flat.nonce(),json.nonce());
+        compare(test,"transactionIndex",flat.transactionIndex(),json.transactionIndex());
+        compare(test,"from",flat.from(),json.from());
+        compare(test,"to",flat.to(),json.to());
+        compare(test,"value",flat.value().weiString(),json.value().weiString());
+        compare(test,"gas",flat.gas(),json.gas());
+        compare(test,"gasPrice",flat.gasPrice(),json.gasPrice());
+        compare(test,"blockHash",flat.blockHash(),json.blockHash());
+        compare(test,"isError",flat.isErrorString(),json.isErrorString());
+        compare(test,"input",flat.input(),json.input());
+        compare(test,"cumulativeGasUsed",flat.cumulativeGasUsed(),json.cumulativeGasUsed());
+        compare(test,"gasUsed",flat.gasUsed(),json.gasUsed());
+        compare(test,"confirmations",flat.confirmations(),json.confirmations());
+        compare(test,"methodId",flat.methodIdString(),json.methodIdString());
+        compare(test,"functionName",flat.functionName(),json.functionName());
+    }
+}
+
+static void compareEventLogs(const char* test, const QByteArray& records)
+{
+    const QByteArray data = reply(records);
+
+    EventLogList flatList;
+    if (!decodeFlatJsonList(data,&flatList)) {
+        qWarning().nospace() << test << ": reply was not decoded by FlatJsonReader";
+        failures++;
+        return;
+    }
+    const EventLogList jsonList(QJsonDocument::fromJson(data).object().value("result"));
+
+    compare(test,"count",flatList.count(),jsonList.count());
+    for (int i = 0; i < qMin(flatList.count(),jsonList.count()); i++) {
+        const EventLog& flat = flatList.at(i);
+        const EventLog& json = jsonList.at(i);
+
+        compare(test,"address",flat.address(),json.address());
+        compare(test,"topics",flat.topics(),json.topics());
+        compare(test,"data",flat.dataString(),json.dataString());
+        compare(test,"blockNumber",flat.blockNumber(),json.blockNumber());
+        compare(test,"timeStamp",flat.timeStamp(),json.timeStamp());
+        compare(test,"gasPrice",flat.gasPrice(),json.gasPrice());
+        compare(test,"gasUsed",flat.gasUsed(),json.gasUsed());
+        compare(test,"logIndex",flat.logIndexString(),json.logIndexString());
+        compare(test,"transactionHash",flat.transactionHash(),json.transactionHash());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    compareTransactions("escaped strings",R"(
+        {"blockNumber":"1","hash":"0x\"quoted\"","input":"a\\b\/c","functionName":"line\nbreak\ttab\r\b\f"},
+        {"blockNumber":"2","from":"","to":"\"","methodId":"\\"}
+    )");
+
+    compareTransactions("unicode escapes",R"(
+        {"blockNumber":"3","functionName":"\u0041\u00e9\u4E2D","input":"\ud83d\ude00 smile","hash":"\u0000end"},
+        {"blockNumber":"4","functionName":"\u00c9\u00e9 not escaped: é","isError":"\u0030"}
+    )");
+
+    compareTransactions("numbers",R"(
+        {"blockNumber":"17000000","timeStamp":"1700000000","nonce":"18446744073709551615","gas":"0",
+         "gasPrice":"  42","transactionIndex":"4294967295","confirmations":"+7","cumulativeGasUsed":"007",
+         "gasUsed":"21000","value":"1000000000000000000"}
+    )");
+
+    compareTransactions("out of range",R"(
+        {"blockNumber":"99999999999","timeStamp":"-1","nonce":"18446744073709551616","gas":"-1",
+         "gasPrice":"1e3","transactionIndex":"4294967296","confirmations":"abc","gasUsed":"0x10",
+         "cumulativeGasUsed":""}
+    )");
+
+    compareEventLogs("event logs",R"(
+        {"address":"0xabc","topics":["0x1","\"2\"","3"],"data":"0x\\00","blockNumber":"0x10",
+         "timeStamp":"0x6553f100","gasPrice":"0xffffffffffffffffff","gasUsed":"0x","logIndex":"0x",
+         "transactionHash":"0xabc","transactionIndex":"0x1"}
+    )");
+
+    if (failures > 0) {
+        qWarning() << failures << "mismatches found";
+        return 1;
+    }
+
+    qDebug() << "Flat JSON decoding matches QJsonDocument";
+    return 0;
+}